@@ -18,5 +18,15 @@
 ]]
 set(ByteUtils_VERSION "1.1")
 set(ByteUtils_INCLUDE_DIRS ${CMAKE_CURRENT_LIST_DIR}/../include)
-set(ByteUtils_LIBRARIES ${CMAKE_CURRENT_LIST_DIR}/../lib/lib_byte_utils.so)
+# Uses the shared library if it was installed, or the static one otherwise.
+if(EXISTS ${CMAKE_CURRENT_LIST_DIR}/../lib/lib_byte_utils.so)
+  set(ByteUtils_LIBRARIES ${CMAKE_CURRENT_LIST_DIR}/../lib/lib_byte_utils.so)
+else()
+  include(CMakeFindDependencyMacro)
+  find_dependency(Threads)
+  set(ByteUtils_LIBRARIES 
+    ${CMAKE_CURRENT_LIST_DIR}/../lib/lib_byte_utils.a 
+    Threads::Threads
+  )
+endif()
 include(${CMAKE_CURRENT_LIST_DIR}/ByteUtilsTargets.cmake)
\ No newline at end of file
@@ -21,7 +21,7 @@ set_target_properties(ByteUtils PROPERTIES
   INTERFACE_INCLUDE_DIRECTORIES ${ByteUtils_INCLUDE_DIRS}
 )
 set_target_properties(ByteUtils PROPERTIES
-  INTERFACE_LINK_LIBRARIES ${ByteUtils_LIBRARIES}
+  INTERFACE_LINK_LIBRARIES "${ByteUtils_LIBRARIES}"
 )
 set_property(TARGET ByteUtils PROPERTY
   INTERFACE_BYTEUTILS_VERSION ${ByteUtils_VERSION}
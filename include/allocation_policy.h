@@ -0,0 +1,58 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_ALLOCATION_POLICY_H_
+#define BYTE_UTILS_ALLOCATION_POLICY_H_
+
+#include <vector>
+
+#include "byte.h"
+
+namespace ByteUtils {
+
+// The `AllocationPolicy` struct describes how the storage of a large 
+// `ByteVector` is backed by memory, to reduce the TLB misses and the 
+// cross-socket accesses of scans over hundreds of MB. The policy is 
+// applied once, when the storage is allocated; on systems other than 
+// Linux it is ignored.
+// Example:
+//    ByteUtils::AllocationPolicy policy;
+//    policy.huge_pages = true;
+//    policy.numa_node = 0;
+//    ByteUtils::ByteVector buffer(1 << 30, policy);
+struct AllocationPolicy {
+  // Asks the kernel to back the storage with transparent huge pages.
+  bool huge_pages = false;
+  // The NUMA node on which the pages are placed by touching them first 
+  // from its CPUs, or `-1` to place them on the node of the caller.
+  int numa_node = -1;
+};
+
+namespace Internal {
+
+// Resizes the empty `bytes` to `size` zero bytes, allocating and touching
+// the storage according to `policy`. Throws `std::invalid_argument` if the
+// NUMA node doesn't exist.
+void AllocateBytes(std::vector<Byte>& bytes, std::size_t size, 
+                   const AllocationPolicy& policy);
+
+}  // namespace Internal
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_ALLOCATION_POLICY_H_
\ No newline at end of file
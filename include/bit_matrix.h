@@ -0,0 +1,98 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_BIT_MATRIX_H_
+#define BYTE_UTILS_BIT_MATRIX_H_
+
+#include <array>
+#include <cstdint>
+
+#include "byte.h"
+#include "byte_vector.h"
+
+namespace ByteUtils {
+
+// Transposes the 8x8 bit matrix stored in `matrix`, where the row `i` is 
+// the `i`-th byte counted from the most significant one and the column `j`
+// is the `j`-th bit of a row counted from its MSB.
+std::uint64_t Transpose8x8(std::uint64_t matrix);
+
+// Transposes in place the 64x64 bit matrix whose row `i` is `matrix[i]`,
+// where the column `j` is the `j`-th bit of a row counted from its MSB.
+void Transpose64x64(std::array<std::uint64_t, 64>& matrix);
+
+// Returns the transpose of the bit matrix with `rows` rows stored row 
+// after row in `block`, each row taking `block.Size() / rows` bytes. 
+// The bits of a row are ordered from the MSB of its first byte. 
+// `rows` must be a multiple of 8 that divides `block.Size()`. The AVX2 
+// `vpmovmskb` instruction transposes 32 rows at a time when the CPU 
+// supports it.
+ByteVector TransposeBits(const ByteVector& block, std::size_t rows);
+
+// The `BitslicedBytes` class holds 64 `Byte` lanes in bitsliced form: 
+// the plane `i` gathers the bit `i` of every lane, so a bitwise operation
+// between planes is applied to all the lanes at once, e.g. to evaluate an
+// S-box circuit in constant time. The lane `n` is stored in the bit `n` 
+// of every plane.
+// Example:
+//    ByteUtils::BitslicedBytes lanes(bytes);
+//    lanes ^= ByteUtils::BitslicedBytes(round_key);
+//    ByteUtils::ByteVector result = lanes.ToByteVector(bytes.Size());
+class BitslicedBytes {
+  public:
+    // The number of `Byte` lanes.
+    static constexpr std::size_t kLanes = 64;
+    BitslicedBytes() = default;
+    // Loads up to 64 bytes into the lanes; the remaining lanes are `0`.
+    explicit BitslicedBytes(const ByteVector& bytes);
+    BitslicedBytes(const BitslicedBytes& other) = default;
+    BitslicedBytes(BitslicedBytes&& other) = default;
+    BitslicedBytes& operator=(const BitslicedBytes& other) = default;
+    BitslicedBytes& operator=(BitslicedBytes&& other) = default;
+    ~BitslicedBytes() = default;
+    // Performs bitwise `XOR` operation on every lane.
+    BitslicedBytes operator^(const BitslicedBytes& other) const;
+    // Performs bitwise `AND` operation on every lane.
+    BitslicedBytes operator&(const BitslicedBytes& other) const;
+    // Performs bitwise `OR` operation on every lane.
+    BitslicedBytes operator|(const BitslicedBytes& other) const;
+    // Returns the complement of every lane.
+    BitslicedBytes operator~() const;
+    // Performs bitwise `XOR` operation on every lane of the current object.
+    BitslicedBytes& operator^=(const BitslicedBytes& other);
+    // Returns the plane that holds the bit `bit` of every lane.
+    inline std::uint64_t operator[](const std::size_t bit) const { 
+      Internal::CheckIndex(bit, 8);
+      return planes_[bit]; 
+    }
+    // Accesses the plane that holds the bit `bit` of every lane.
+    inline std::uint64_t& operator[](const std::size_t bit) { 
+      Internal::CheckIndex(bit, 8);
+      return planes_[bit]; 
+    }
+    // Returns the `Byte` from the lane `lane`.
+    Byte Lane(std::size_t lane) const;
+    // Returns the first `count` lanes as a `ByteVector` object.
+    ByteVector ToByteVector(std::size_t count = kLanes) const;
+  private:
+    std::array<std::uint64_t, 8> planes_{};
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_BIT_MATRIX_H_
\ No newline at end of file
@@ -0,0 +1,127 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_BIT_STREAM_H_
+#define BYTE_UTILS_BIT_STREAM_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "byte.h"
+#include "byte_vector.h"
+#include "shared_byte_vector.h"
+
+namespace ByteUtils {
+
+// The order in which the bits of a byte are consumed or produced.
+enum class BitOrder {
+  // The MSB of every byte comes first, as in most network and 
+  // multimedia formats.
+  kMsbFirst,
+  // The LSB of every byte comes first, as in DEFLATE.
+  kLsbFirst
+};
+
+// The `BitReader` class reads fields of up to 64 bits from a sequence of
+// bytes, buffering 64 bits at a time. Fields read in `BitOrder::kMsbFirst`
+// order have their first bit as the most significant one, while fields read
+// in `BitOrder::kLsbFirst` order have their first bit as the least 
+// significant one. A reader created from a `ByteVector` must not outlive it.
+// Example:
+//    ByteUtils::BitReader reader(bytes);
+//    std::uint64_t version = reader.Read(4);
+//    std::uint64_t length = reader.Read(12);
+class BitReader {
+  public:
+    explicit BitReader(const ByteVector& bytes, 
+                       BitOrder order = BitOrder::kMsbFirst);
+    // Keeps a reference to the buffer of the view while reading.
+    explicit BitReader(const SharedByteVector& bytes, 
+                       BitOrder order = BitOrder::kMsbFirst);
+    BitReader(const BitReader& other) = default;
+    BitReader(BitReader&& other) = default;
+    BitReader& operator=(const BitReader& other) = default;
+    BitReader& operator=(BitReader&& other) = default;
+    ~BitReader() = default;
+    // Returns the next `n_bits` bits (at most 57) without consuming them.
+    std::uint64_t Peek(std::size_t n_bits);
+    // Consumes the next `n_bits` bits.
+    void Skip(std::size_t n_bits);
+    // Returns and consumes the next `n_bits` bits (at most 64).
+    std::uint64_t Read(std::size_t n_bits);
+    // Skips the remaining bits of the current byte.
+    void AlignToByte();
+    // Returns the number of bits that were not consumed.
+    inline std::size_t BitsLeft() const { 
+      return (size_ - position_) * 8 + count_; 
+    }
+  private:
+    // Loads whole bytes into the buffer until it holds at least 57 bits 
+    // or the input is exhausted.
+    void Refill();
+    // Throws `std::out_of_range` if less than `n_bits` bits are left.
+    void Require(std::size_t n_bits) const;
+    SharedByteVector owner_;
+    const Byte* data_;
+    std::size_t size_;
+    std::size_t position_ = 0;
+    BitOrder order_;
+    // The buffered bits are aligned to the MSB of `buffer_` for 
+    // `kMsbFirst` order and to the LSB for `kLsbFirst` order.
+    std::uint64_t buffer_ = 0;
+    std::size_t count_ = 0;
+};
+
+// The `BitWriter` class packs fields of up to 64 bits into bytes, 
+// using the same conventions as `BitReader`.
+// Example:
+//    ByteUtils::BitWriter writer;
+//    writer.Write(4, 4);
+//    writer.Write(20, 12);
+//    ByteUtils::ByteVector bytes = writer.Finish();
+class BitWriter {
+  public:
+    explicit BitWriter(BitOrder order = BitOrder::kMsbFirst);
+    BitWriter(const BitWriter& other) = default;
+    BitWriter(BitWriter&& other) = default;
+    BitWriter& operator=(const BitWriter& other) = default;
+    BitWriter& operator=(BitWriter&& other) = default;
+    ~BitWriter() = default;
+    // Appends the `n_bits` (at most 64) low bits of `value`.
+    void Write(std::uint64_t value, std::size_t n_bits);
+    // Pads the current byte with `0` bits.
+    void AlignToByte();
+    // Returns the written bytes, padding the last one with `0` bits,
+    // and clears the writer.
+    ByteVector Finish();
+    // Returns the number of written bits.
+    inline std::size_t BitCount() const { return bytes_.size() * 8 + count_; }
+  private:
+    // Moves the whole bytes from the buffer to `bytes_`.
+    void Flush();
+    std::vector<Byte> bytes_;
+    BitOrder order_;
+    // The pending bits are aligned to the LSB of `buffer_`; for 
+    // `kMsbFirst` order the oldest bit is the most significant one.
+    std::uint64_t buffer_ = 0;
+    std::size_t count_ = 0;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_BIT_STREAM_H_
\ No newline at end of file
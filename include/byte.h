@@ -20,12 +20,37 @@
 #define BYTE_UITILS_BYTE_H_
 
 #include <bitset>
+#include <cassert>
 #include <cstdint>
 #include <ostream>
 #include <string>
 
+#include "byte_utils_config.h"
+
 namespace ByteUtils {
 
+namespace Internal {
+
+// Throws `std::out_of_range` for the position `pos` of a sequence of 
+// `size` elements. It is kept out of line, so that the checked accessors
+// stay small enough to be inlined.
+[[noreturn]] void ThrowOutOfRange(std::size_t pos, std::size_t size);
+
+// Checks that `pos` is a valid position in a sequence of `size` elements.
+// When the library is built with `BYTE_UTILS_UNCHECKED_ACCESS`, the check 
+// is only an assertion, which is removed from the release builds.
+inline void CheckIndex(std::size_t pos, std::size_t size) {
+#if BYTE_UTILS_UNCHECKED_ACCESS
+  assert(pos < size);
+#else
+  if (pos >= size) {
+    ThrowOutOfRange(pos, size);
+  }
+#endif
+}
+
+}  // namespace Internal
+
 // The `Byte` class manage and performs bitwise operations on 
 // an array of 8 bits. The bit positioned at the far left signifies 
 // the MSB, while the bit at the far right signifies LSB.
@@ -88,9 +113,9 @@ class Byte {
     };
     Byte() = default;
     // Initializes the `Byte` object with 8 bits of data.
-    Byte(const std::bitset<8>& byte);
+    constexpr Byte(const std::bitset<8>& byte): byte_(byte) {}
     // Initializes the `Byte` object with 8 bits of data.
-    Byte(const std::uint8_t data);
+    constexpr Byte(const std::uint8_t data): byte_(data) {}
     // Initializes the `Byte` object with exact 8 bits of `data`
     // in given `base`, where `base` can be 2 or 16.
     Byte(const std::string& data, const uint8_t base);
@@ -113,38 +138,77 @@ class Byte {
     // Returns a reference to the MSB.
     ReverseIterator rend() { return ReverseIterator(byte_, -1); }
     // Performs bitwise `AND` operation between two `Byte` objects.
-    Byte operator&(const Byte& data) const;
+    inline Byte operator&(const Byte& data) const { 
+      return byte_ & data.byte_; 
+    }
     // Performs bitwise `OR` operation between two `Byte` objects.
-    Byte operator|(const Byte& data) const;
+    inline Byte operator|(const Byte& data) const { 
+      return byte_ | data.byte_; 
+    }
     // Performs bitwise `XOR` operation between two `Byte` objects.
-    Byte operator^(const Byte& data) const;
+    inline Byte operator^(const Byte& data) const { 
+      return byte_ ^ data.byte_; 
+    }
     // Performs bitwise `XOR` on current `Byte` object.
-    Byte& operator^=(const Byte& data);
+    inline Byte& operator^=(const Byte& data) { 
+      byte_ ^= data.byte_; 
+      return *this; 
+    }
     // Returns the complement of the current `Byte` object.
-    Byte operator~() const;
+    inline Byte operator~() const { return ~byte_; }
     // Performs left shift with `n_pos` positions.
-    Byte operator<<(const std::size_t n_pos) const;
+    inline Byte operator<<(const std::size_t n_pos) const { 
+      return byte_ << n_pos; 
+    }
     // Performs left shift on current `Byte` object with `n_pos` positions.
-    Byte& operator<<=(const std::size_t n_pos);
+    inline Byte& operator<<=(const std::size_t n_pos) { 
+      byte_ <<= n_pos; 
+      return *this; 
+    }
     // Performs right shift on current `Byte` object with `n_pos` positions.
-    Byte& operator>>=(const std::size_t n_pos);
+    inline Byte& operator>>=(const std::size_t n_pos) { 
+      byte_ >>= n_pos; 
+      return *this; 
+    }
     // Performs Galois Field multiplication between two `Byte` objects.
     Byte operator*(const Byte& byte) const;
     // Returns the bit from the position `pos`.
-    bool operator[](const std::size_t pos) const;
+    inline bool operator[](const std::size_t pos) const { 
+      Internal::CheckIndex(pos, 8);
+      return byte_[pos]; 
+    }
     // Accesses the bit from the position `pos` through 
     // `std::bitset::reference`.
-    std::bitset<8>::reference operator[](const std::size_t pos);
+    inline std::bitset<8>::reference operator[](const std::size_t pos) { 
+      Internal::CheckIndex(pos, 8);
+      return byte_[pos]; 
+    }
+    // Checks if two `Byte` objects hold the same bits.
+    inline bool operator==(const Byte& data) const { 
+      return byte_ == data.byte_; 
+    }
+    inline bool operator!=(const Byte& data) const { 
+      return byte_ != data.byte_; 
+    }
+    // Compares two `Byte` objects as unsigned values.
+    inline bool operator<(const Byte& data) const { 
+      return byte_.to_ulong() < data.byte_.to_ulong(); 
+    }
     // Checks if at least one bit is set to `1`.
     inline bool IsAnySet() const { return byte_.any(); }
     inline int ToInt() const { return byte_.to_ulong(); }
     inline char ToAscii() const { return byte_.to_ulong(); }
+    // Reverses the order of the bits, so that the MSB becomes the LSB.
+    void ReverseBits();
     std::string ToHex() const;
     inline const std::bitset<8>& GetByte() const { return byte_; }
   private:
     std::bitset<8> byte_;
 };
 
+// Returns a copy of `byte` with the order of the bits reversed.
+Byte ReverseBits(Byte byte);
+
 }  // namespace ByteUtils
 
 #endif  // BYTE_UITILS_BYTE_H_
\ No newline at end of file
@@ -0,0 +1,370 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_BYTE_EXPRESSION_H_
+#define BYTE_UTILS_BYTE_EXPRESSION_H_
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "byte.h"
+#include "byte_vector.h"
+#include "word.h"
+
+namespace ByteUtils {
+
+// The `ByteExpression` class is the base of the lazily evaluated bitwise
+// expressions over `ByteVector` and `Word` objects. An expression only
+// records its operands; the bytes are computed one position at a time when
+// the expression is assigned to a `ByteVector` or a `Word`, so a chain of
+// operators is evaluated in a single pass without temporary vectors. 
+// Only a shift over an expression that has shifts itself evaluates its 
+// operand into a buffer, when it is built.
+// The operands must outlive the expression.
+// Example:
+//    ByteUtils::ByteVector result = (Lazy(a) ^ b) & ~Lazy(c);
+template <typename Expression>
+class ByteExpression {
+  public:
+    // Returns the derived expression object.
+    inline const Expression& Self() const { 
+      return static_cast<const Expression&>(*this); 
+    }
+};
+
+// The `ByteTerminal` class refers to the bytes of a `ByteVector` or 
+// `Word` object as a leaf of an expression.
+class ByteTerminal : public ByteExpression<ByteTerminal> {
+  public:
+    ByteTerminal(const Byte* bytes, std::size_t size)
+        : bytes_(bytes), size_(size) {}
+    // Returns the number of bytes of the expression.
+    inline std::size_t Size() const { return size_; }
+    // Returns the value of the byte from the position `pos`.
+    inline std::uint8_t At(std::size_t pos) const { 
+      return bytes_[pos].ToInt(); 
+    }
+  private:
+    const Byte* bytes_;
+    std::size_t size_;
+};
+
+// Wraps the `ByteVector` object as the start of a lazy expression.
+inline ByteTerminal Lazy(const ByteVector& bytes) {
+  return ByteTerminal(bytes.bytes_.data(), bytes.bytes_.size());
+}
+
+// Wraps the `Word` object as the start of a lazy expression.
+inline ByteTerminal Lazy(const Word& word) {
+  return ByteTerminal(word.word_.data(), word.word_.size());
+}
+
+// The `BinaryExpression` class applies the bitwise `Operation` between 
+// the bytes from the same position of two expressions of equal size.
+template <typename Operation, typename Left, typename Right>
+class BinaryExpression 
+    : public ByteExpression<BinaryExpression<Operation, Left, Right>> {
+  public:
+    BinaryExpression(const Left& left, const Right& right)
+        : left_(left), right_(right) {
+      if (left_.Size() != right_.Size()) {
+        throw std::runtime_error("Can't perform bitwise operation between " 
+                                 "operands with different sizes.");
+      }
+    }
+    inline std::size_t Size() const { return left_.Size(); }
+    inline std::uint8_t At(std::size_t pos) const {
+      return Operation::Apply(left_.At(pos), right_.At(pos));
+    }
+  private:
+    Left left_;
+    Right right_;
+};
+
+// The `ComplementExpression` class returns the complement of the bytes 
+// of an expression.
+template <typename Operand>
+class ComplementExpression 
+    : public ByteExpression<ComplementExpression<Operand>> {
+  public:
+    explicit ComplementExpression(const Operand& operand)
+        : operand_(operand) {}
+    inline std::size_t Size() const { return operand_.Size(); }
+    inline std::uint8_t At(std::size_t pos) const {
+      return static_cast<std::uint8_t>(~operand_.At(pos));
+    }
+  private:
+    Operand operand_;
+};
+
+template <typename Operand>
+class ShiftLeftExpression;
+
+template <typename Operand>
+class ShiftRightExpression;
+
+namespace Internal {
+
+// Checks if the expression has a shift among its nodes.
+template <typename Expression>
+struct ContainsShift : std::false_type {};
+
+template <typename Operation, typename Left, typename Right>
+struct ContainsShift<BinaryExpression<Operation, Left, Right>>
+    : std::integral_constant<bool, ContainsShift<Left>::value || 
+                                   ContainsShift<Right>::value> {};
+
+template <typename Operand>
+struct ContainsShift<ComplementExpression<Operand>> 
+    : ContainsShift<Operand> {};
+
+template <typename Operand>
+struct ContainsShift<ShiftLeftExpression<Operand>> : std::true_type {};
+
+template <typename Operand>
+struct ContainsShift<ShiftRightExpression<Operand>> : std::true_type {};
+
+// The operand of a shift, which reads two bytes of it for every byte 
+// it returns. An operand without shifts is read directly.
+template <typename Operand, bool = ContainsShift<Operand>::value>
+class ShiftOperand {
+  public:
+    explicit ShiftOperand(const Operand& operand): operand_(operand) {}
+    inline std::size_t Size() const { return operand_.Size(); }
+    inline std::uint8_t At(std::size_t pos) const { return operand_.At(pos); }
+  private:
+    Operand operand_;
+};
+
+// An operand that contains shifts is evaluated once into a buffer, 
+// since reading it directly would double the work at every nested shift.
+template <typename Operand>
+class ShiftOperand<Operand, true> {
+  public:
+    explicit ShiftOperand(const Operand& operand)
+        : bytes_(std::make_shared<std::vector<std::uint8_t>>(operand.Size())) {
+      for (std::size_t pos = 0; pos < bytes_->size(); pos++) {
+        (*bytes_)[pos] = operand.At(pos);
+      }
+    }
+    inline std::size_t Size() const { return bytes_->size(); }
+    inline std::uint8_t At(std::size_t pos) const { return (*bytes_)[pos]; }
+  private:
+    std::shared_ptr<std::vector<std::uint8_t>> bytes_;
+};
+
+}  // namespace Internal
+
+// The `ShiftLeftExpression` class shifts an expression by `n_pos` bits 
+// towards the MSB.
+template <typename Operand>
+class ShiftLeftExpression 
+    : public ByteExpression<ShiftLeftExpression<Operand>> {
+  public:
+    ShiftLeftExpression(const Operand& operand, std::size_t n_pos)
+        : operand_(operand), n_bytes_(n_pos / 8), n_bits_(n_pos % 8) {
+      if (n_pos > operand_.Size() * 8) {
+        throw std::out_of_range("n_pos is out of range.");
+      }
+    }
+    inline std::size_t Size() const { return operand_.Size(); }
+    inline std::uint8_t At(std::size_t pos) const {
+      std::size_t source = pos + n_bytes_;
+      unsigned int high = source < Size() ? operand_.At(source) : 0;
+      unsigned int low = source + 1 < Size() ? operand_.At(source+1) : 0;
+      return static_cast<std::uint8_t>((high << n_bits_) | 
+                                       (low >> (8 - n_bits_)));
+    }
+  private:
+    Internal::ShiftOperand<Operand> operand_;
+    std::size_t n_bytes_;
+    std::size_t n_bits_;
+};
+
+// The `ShiftRightExpression` class shifts an expression by `n_pos` bits 
+// towards the LSB.
+template <typename Operand>
+class ShiftRightExpression 
+    : public ByteExpression<ShiftRightExpression<Operand>> {
+  public:
+    ShiftRightExpression(const Operand& operand, std::size_t n_pos)
+        : operand_(operand), n_bytes_(n_pos / 8), n_bits_(n_pos % 8) {
+      if (n_pos > operand_.Size() * 8) {
+        throw std::out_of_range("n_pos is out of range.");
+      }
+    }
+    inline std::size_t Size() const { return operand_.Size(); }
+    inline std::uint8_t At(std::size_t pos) const {
+      unsigned int low = pos >= n_bytes_ ? operand_.At(pos-n_bytes_) : 0;
+      unsigned int high = pos >= n_bytes_ + 1 ? 
+                          operand_.At(pos-n_bytes_-1) : 0;
+      return static_cast<std::uint8_t>((low >> n_bits_) | 
+                                       (high << (8 - n_bits_)));
+    }
+  private:
+    Internal::ShiftOperand<Operand> operand_;
+    std::size_t n_bytes_;
+    std::size_t n_bits_;
+};
+
+struct XorOperation {
+  static inline std::uint8_t Apply(std::uint8_t a, std::uint8_t b) { 
+    return a ^ b; 
+  }
+};
+
+struct AndOperation {
+  static inline std::uint8_t Apply(std::uint8_t a, std::uint8_t b) { 
+    return a & b; 
+  }
+};
+
+struct OrOperation {
+  static inline std::uint8_t Apply(std::uint8_t a, std::uint8_t b) { 
+    return a | b; 
+  }
+};
+
+namespace Internal {
+
+// Converts an operand of a lazy operator into an expression.
+template <typename Expression>
+inline const Expression& ToExpression(const ByteExpression<Expression>& e) {
+  return e.Self();
+}
+
+inline ByteTerminal ToExpression(const ByteVector& bytes) { 
+  return Lazy(bytes); 
+}
+
+inline ByteTerminal ToExpression(const Word& word) { return Lazy(word); }
+
+template <typename T>
+using Decay = std::remove_cv_t<std::remove_reference_t<T>>;
+
+template <typename T>
+constexpr bool kIsExpression = 
+    std::is_base_of_v<ByteExpression<Decay<T>>, Decay<T>>;
+
+template <typename T>
+constexpr bool kIsOperand = kIsExpression<T> || 
+                            std::is_same_v<Decay<T>, ByteVector> ||
+                            std::is_same_v<Decay<T>, Word>;
+
+// Enables the lazy operators only when one of the operands is already an
+// expression, so the eager operators of `ByteVector` and `Word` are kept.
+template <typename Left, typename Right>
+using EnableLazy = std::enable_if_t<kIsOperand<Left> && kIsOperand<Right> &&
+                                    (kIsExpression<Left> || 
+                                     kIsExpression<Right>)>;
+
+template <typename T>
+using ExpressionType = Decay<decltype(ToExpression(std::declval<const T&>()))>;
+
+}  // namespace Internal
+
+// Builds the lazy XOR operation between two operands.
+template <typename Left, typename Right, 
+          typename = Internal::EnableLazy<Left, Right>>
+inline BinaryExpression<XorOperation, Internal::ExpressionType<Left>, 
+                        Internal::ExpressionType<Right>>
+operator^(const Left& left, const Right& right) {
+  return {Internal::ToExpression(left), Internal::ToExpression(right)};
+}
+
+// Builds the lazy AND operation between two operands.
+template <typename Left, typename Right, 
+          typename = Internal::EnableLazy<Left, Right>>
+inline BinaryExpression<AndOperation, Internal::ExpressionType<Left>, 
+                        Internal::ExpressionType<Right>>
+operator&(const Left& left, const Right& right) {
+  return {Internal::ToExpression(left), Internal::ToExpression(right)};
+}
+
+// Builds the lazy OR operation between two operands.
+template <typename Left, typename Right, 
+          typename = Internal::EnableLazy<Left, Right>>
+inline BinaryExpression<OrOperation, Internal::ExpressionType<Left>, 
+                        Internal::ExpressionType<Right>>
+operator|(const Left& left, const Right& right) {
+  return {Internal::ToExpression(left), Internal::ToExpression(right)};
+}
+
+// Builds the lazy complement of an expression.
+template <typename Operand>
+inline ComplementExpression<Operand> operator~(
+    const ByteExpression<Operand>& operand) {
+  return ComplementExpression<Operand>(operand.Self());
+}
+
+// Builds the lazy left shift of an expression by `n_pos` bits.
+template <typename Operand>
+inline ShiftLeftExpression<Operand> operator<<(
+    const ByteExpression<Operand>& operand, std::size_t n_pos) {
+  return ShiftLeftExpression<Operand>(operand.Self(), n_pos);
+}
+
+// Builds the lazy right shift of an expression by `n_pos` bits.
+template <typename Operand>
+inline ShiftRightExpression<Operand> operator>>(
+    const ByteExpression<Operand>& operand, std::size_t n_pos) {
+  return ShiftRightExpression<Operand>(operand.Self(), n_pos);
+}
+
+template <typename Expression>
+ByteVector::ByteVector(const ByteExpression<Expression>& expression) {
+  const Expression& self = expression.Self();
+  const std::size_t size = self.Size();
+  bytes_.reserve(size);
+  for (std::size_t index = 0; index < size; index++) {
+    bytes_.emplace_back(self.At(index));
+  }
+}
+
+template <typename Expression>
+ByteVector& ByteVector::operator=(
+    const ByteExpression<Expression>& expression) {
+  // Evaluates into new storage, since the expression can refer to 
+  // the current object.
+  return *this = ByteVector(expression);
+}
+
+template <typename Expression>
+Word::Word(const ByteExpression<Expression>& expression) {
+  const Expression& self = expression.Self();
+  const std::size_t size = self.Size();
+  word_.reserve(size);
+  for (std::size_t index = 0; index < size; index++) {
+    word_.emplace_back(self.At(index));
+  }
+}
+
+template <typename Expression>
+Word& Word::operator=(const ByteExpression<Expression>& expression) {
+  // Evaluates into new storage, since the expression can refer to 
+  // the current object.
+  return *this = Word(expression);
+}
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_BYTE_EXPRESSION_H_
\ No newline at end of file
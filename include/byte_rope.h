@@ -0,0 +1,134 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_BYTE_ROPE_H_
+#define BYTE_UTILS_BYTE_ROPE_H_
+
+#include <cstddef>
+#include <deque>
+
+#include "byte.h"
+#include "byte_vector.h"
+#include "shared_byte_vector.h"
+
+namespace ByteUtils {
+
+// The `ByteRope` class holds a sequence of bytes as a list of shared 
+// chunks. Appending, prepending and concatenating only link chunks and 
+// never copy the bytes; a contiguous `ByteVector` is built on demand.
+// The const members don't modify the object, so a `ByteRope` can be read 
+// from multiple threads; modifying it requires external synchronization.
+// Example:
+//    ByteUtils::ByteRope message;
+//    message.Append(ByteUtils::ByteVector("0a1b"));
+//    message.Prepend(ByteUtils::ByteVector("ff"));
+//    std::cout << message.Flatten().ToHex();
+class ByteRope {
+  public:
+    // The class `ConstIterator` walks the bytes of a `ByteRope` instance
+    // chunk by chunk, without looking up the chunk of each position.
+    class ConstIterator {
+      public:
+        ConstIterator(const std::deque<SharedByteVector>& chunks, 
+                      std::size_t chunk)
+            : chunks_(&chunks), chunk_(chunk) { 
+          SkipEmptyChunks(); 
+        }
+        // Moves to the next byte, crossing to the next chunk if needed.
+        inline ConstIterator& operator++() {
+          if (++current_ == end_) {
+            ++chunk_;
+            SkipEmptyChunks();
+          }
+          return *this;
+        }
+        // Returns a reference to a `Byte` from the `ByteRope` object.
+        inline const Byte& operator*() const { return *current_; }
+        // Returns a pointer to a `Byte` from the `ByteRope` object.
+        inline const Byte* operator->() const { return current_; }
+        inline bool operator!=(const ConstIterator& other) const {
+          return chunks_ != other.chunks_ || chunk_ != other.chunk_ || 
+                 current_ != other.current_;
+        }
+      private:
+        // Moves to the first byte of the next non-empty chunk.
+        inline void SkipEmptyChunks() {
+          while (chunk_ < chunks_->size() && (*chunks_)[chunk_].Size() == 0) {
+            ++chunk_;
+          }
+          if (chunk_ < chunks_->size()) {
+            current_ = (*chunks_)[chunk_].Data();
+            end_ = current_ + (*chunks_)[chunk_].Size();
+          } else {
+            current_ = end_ = nullptr;
+          }
+        }
+        const std::deque<SharedByteVector>* chunks_;
+        std::size_t chunk_;
+        const Byte* current_ = nullptr;
+        const Byte* end_ = nullptr;
+    };
+    ByteRope() = default;
+    // Initializes the `ByteRope` object with a single chunk.
+    explicit ByteRope(const SharedByteVector& bytes);
+    ByteRope(const ByteRope& other) = default;
+    ByteRope(ByteRope&& other) = default;
+    ByteRope& operator=(const ByteRope& other) = default;
+    ByteRope& operator=(ByteRope&& other) = default;
+    ~ByteRope() = default;
+    // Returns the `ConstIterator` that points to the first `Byte`.
+    ConstIterator begin() const { return ConstIterator(chunks_, 0); }
+    // Returns the `ConstIterator` that points past the last `Byte`.
+    ConstIterator end() const { 
+      return ConstIterator(chunks_, chunks_.size()); 
+    }
+    // Returns the `Byte` from the position `pos`.
+    Byte operator[](const std::size_t pos) const;
+    // Appends the bytes as a new chunk.
+    void Append(const SharedByteVector& bytes);
+    // Appends the bytes as a new chunk, without copying them.
+    void Append(ByteVector&& bytes);
+    // Appends the chunks of another `ByteRope` object.
+    void Append(const ByteRope& rope);
+    // Prepends the bytes as a new chunk.
+    void Prepend(const SharedByteVector& bytes);
+    // Prepends the bytes as a new chunk, without copying them.
+    void Prepend(ByteVector&& bytes);
+    // Prepends the chunks of another `ByteRope` object.
+    void Prepend(const ByteRope& rope);
+    // Returns the concatenation of two `ByteRope` objects.
+    ByteRope operator+(const ByteRope& rope) const;
+    // Copies all the bytes into a contiguous `ByteVector` object.
+    ByteVector Flatten() const;
+    // Returns the number of chunks.
+    inline std::size_t ChunkCount() const { return chunks_.size(); }
+    // Returns the number of bytes from the `ByteRope` object.
+    inline std::size_t Size() const { return size_; }
+  private:
+    std::deque<SharedByteVector> chunks_;
+    std::size_t size_ = 0;
+    // The offset where each chunk begins, relative to `origin_`, the 
+    // offset of the first byte. Prepending moves the origin backwards, 
+    // so the offsets are kept up to date in O(1) time by every change.
+    std::deque<std::ptrdiff_t> offsets_;
+    std::ptrdiff_t origin_ = 0;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_BYTE_ROPE_H_
\ No newline at end of file
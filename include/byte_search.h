@@ -0,0 +1,80 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_BYTE_SEARCH_H_
+#define BYTE_UTILS_BYTE_SEARCH_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "byte_vector.h"
+
+namespace ByteUtils {
+
+// The `MultiPatternSearcher` class finds the occurrences of a set of 
+// patterns in a single pass over a `ByteVector`, using an Aho-Corasick 
+// automaton built once from the patterns.
+// Example:
+//    ByteUtils::MultiPatternSearcher searcher({ByteUtils::ByteVector("0d0a"),
+//                                              ByteUtils::ByteVector("00")});
+//    for (const auto& match : searcher.FindAll(bytes)) {
+//      std::cout << match.position << " " << match.pattern << std::endl;
+//    }
+class MultiPatternSearcher {
+  public:
+    // The `Match` struct describes an occurrence of the pattern with 
+    // index `pattern` starting from `position`.
+    struct Match {
+      std::size_t position;
+      std::size_t pattern;
+    };
+    // Builds the automaton for the non-empty `patterns`.
+    explicit MultiPatternSearcher(const std::vector<ByteVector>& patterns);
+    MultiPatternSearcher(const MultiPatternSearcher& other) = default;
+    MultiPatternSearcher(MultiPatternSearcher&& other) = default;
+    MultiPatternSearcher& operator=(const MultiPatternSearcher& other) = default;
+    MultiPatternSearcher& operator=(MultiPatternSearcher&& other) = default;
+    ~MultiPatternSearcher() = default;
+    // Returns all the occurrences of the patterns, ordered by the 
+    // position where they end.
+    std::vector<Match> FindAll(const ByteVector& haystack) const;
+    // Checks if any pattern occurs in `haystack`.
+    bool ContainsAny(const ByteVector& haystack) const;
+  private:
+    // Returns the state reached from `state` by reading `byte`.
+    inline std::uint32_t Next(std::uint32_t state, std::uint8_t byte) const {
+      return transitions_[state * 256 + byte];
+    }
+    // Returns the first position from `index` of `block` that holds a 
+    // byte starting a pattern, or `length`. The AVX2 instructions test 
+    // 32 bytes at a time when the patterns start with at most 4 distinct 
+    // bytes and the CPU supports them.
+    std::size_t SkipToStart(const std::uint8_t* block, std::size_t index, 
+                            std::size_t length) const;
+    std::vector<std::size_t> sizes_;
+    // The full transition table, 256 entries for each state.
+    std::vector<std::uint32_t> transitions_;
+    // The patterns that end at each state, including through suffixes.
+    std::vector<std::vector<std::size_t>> outputs_;
+    // The distinct first bytes of the patterns.
+    std::vector<std::uint8_t> starts_;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_BYTE_SEARCH_H_
\ No newline at end of file
@@ -0,0 +1,113 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_BYTE_STREAM_H_
+#define BYTE_UTILS_BYTE_STREAM_H_
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <vector>
+
+#include "byte.h"
+#include "byte_vector.h"
+#include "word.h"
+
+namespace ByteUtils {
+
+// The `ByteVectorBuilder` class appends bytes into a chain of fixed-size
+// chunks, so growing the data never copies the bytes already appended.
+// The result can be built into a single `ByteVector` or written directly
+// to a file descriptor or a stream.
+// Example:
+//    ByteUtils::ByteVectorBuilder builder;
+//    builder.Append(ByteUtils::Word("1a1b1c1d"));
+//    builder.WriteTo(STDOUT_FILENO);
+class ByteVectorBuilder {
+  public:
+    // Creates an empty builder with chunks of `chunk_size` bytes.
+    explicit ByteVectorBuilder(std::size_t chunk_size = 64 * 1024);
+    ByteVectorBuilder(const ByteVectorBuilder& other) = default;
+    ByteVectorBuilder(ByteVectorBuilder&& other) = default;
+    ByteVectorBuilder& operator=(const ByteVectorBuilder& other) = default;
+    ByteVectorBuilder& operator=(ByteVectorBuilder&& other) = default;
+    ~ByteVectorBuilder() = default;
+    // Appends a `Byte` object.
+    void Append(const Byte& byte);
+    // Appends the bytes from the `Word` object.
+    void Append(const Word& word);
+    // Appends the bytes from the `ByteVector` object.
+    void Append(const ByteVector& bytes);
+    // Appends `size` raw bytes starting from `data`.
+    void Append(const std::uint8_t* data, std::size_t size);
+    // Returns a `ByteVector` object with all the appended bytes.
+    ByteVector Build() const;
+    // Writes all the appended bytes to the file descriptor `fd` using 
+    // scatter-gather I/O.
+    void WriteTo(int fd) const;
+    // Writes all the appended bytes to `stream`. Throws 
+    // `std::runtime_error` if the stream fails.
+    void WriteTo(std::ostream& stream) const;
+    // Removes all the appended bytes.
+    void Clear();
+    // Returns the number of appended bytes.
+    inline std::size_t Size() const { return size_; }
+  private:
+    // Returns the chunk with free space, adding a new one if needed.
+    std::vector<std::uint8_t>& CurrentChunk();
+    std::size_t chunk_size_;
+    std::size_t size_ = 0;
+    std::vector<std::vector<std::uint8_t>> chunks_;
+};
+
+// The `ByteVectorReader` class consumes a file descriptor or a stream
+// in chunks of fixed size.
+// Example:
+//    ByteUtils::ByteVectorReader reader(STDIN_FILENO);
+//    ByteUtils::ByteVector chunk;
+//    while (reader.Next(chunk)) {
+//      std::cout << chunk.ToHex();
+//    }
+class ByteVectorReader {
+  public:
+    // Reads from the file descriptor `fd` in chunks of `chunk_size` bytes.
+    explicit ByteVectorReader(int fd, std::size_t chunk_size = 64 * 1024);
+    // Reads from `stream` in chunks of `chunk_size` bytes.
+    explicit ByteVectorReader(std::istream& stream, 
+                              std::size_t chunk_size = 64 * 1024);
+    ByteVectorReader(const ByteVectorReader& other) = delete;
+    ByteVectorReader(ByteVectorReader&& other) = default;
+    ByteVectorReader& operator=(const ByteVectorReader& other) = delete;
+    ByteVectorReader& operator=(ByteVectorReader&& other) = default;
+    ~ByteVectorReader() = default;
+    // Reads the next chunk into `chunk`. The last chunk can be shorter 
+    // than the chunk size. Returns `false` when the input is exhausted.
+    bool Next(ByteVector& chunk);
+  private:
+    // Reads up to `size` bytes into `data` and returns the number 
+    // of bytes read.
+    std::size_t Read(std::uint8_t* data, std::size_t size);
+    int fd_ = -1;
+    std::istream* stream_ = nullptr;
+    std::size_t chunk_size_;
+    std::vector<std::uint8_t> buffer_;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_BYTE_STREAM_H_
\ No newline at end of file
@@ -19,6 +19,7 @@
 #ifndef BYTE_UTILS_BYTE_VECTOR_H_
 #define BYTE_UTILS_BYTE_VECTOR_H_
 
+#include <array>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -27,7 +28,20 @@
 
 namespace ByteUtils {
 
+class ByteTerminal;
 class Word;
+struct AllocationPolicy;
+
+template <typename Expression>
+class ByteExpression;
+
+// The alphabets used for the Base64 representation of a `ByteVector`.
+enum class Base64Alphabet {
+  // Uses `+` and `/` for the values 62 and 63 (RFC 4648, section 4).
+  kStandard,
+  // Uses `-` and `_` for the values 62 and 63 (RFC 4648, section 5).
+  kUrlSafe
+};
 
 // The `ByteVector` class manage a vector of `N` `Byte` objects. 
 // Example:
@@ -119,15 +133,31 @@ class ByteVector{
         const std::vector<Byte>* bytes_;
         std::size_t index_;
     };
+    // The position returned by the search functions when nothing is found.
+    static constexpr std::size_t kNotFound = static_cast<std::size_t>(-1);
     ByteVector() = default;
     // Initializes the `ByteVector` object with a string of hexadecimal values.
     ByteVector(const std::string& hex_string);
     // Initializes the `ByteVector` object with a vector of `Byte` objects.
     ByteVector(const std::vector<Byte>& bytes);
+    // Initializes the `ByteVector` object by taking over a vector 
+    // of `Byte` objects.
+    ByteVector(std::vector<Byte>&& bytes);
+    // Initializes the `ByteVector` object with `size` zero bytes whose 
+    // storage is allocated according to `policy`.
+    // See `allocation_policy.h`.
+    ByteVector(std::size_t size, const AllocationPolicy& policy);
+    // Evaluates the lazy `expression` in a single pass.
+    // See `byte_expression.h`.
+    template <typename Expression>
+    ByteVector(const ByteExpression<Expression>& expression);
     ByteVector(const ByteVector& other) = default;
     ByteVector(ByteVector&& other) = default;
     ByteVector& operator=(const ByteVector& other) = default;
     ByteVector& operator=(ByteVector&& other) = default;
+    // Evaluates the lazy `expression` in a single pass.
+    template <typename Expression>
+    ByteVector& operator=(const ByteExpression<Expression>& expression);
     ~ByteVector() = default;
     // Prints the `ByteVector` objects as an array of bits.
     friend std::ostream& operator<<(std::ostream& stream, 
@@ -160,10 +190,62 @@ class ByteVector{
     ConstReverseIterator rend() const { 
       return ConstReverseIterator(bytes_, -1);
     }
+    // Performs the XOR operation between two `ByteVector` objects.
+    ByteVector operator^(const ByteVector& bytes) const &;
+    // Performs the XOR operation reusing the storage of a 
+    // temporary `ByteVector`.
+    ByteVector operator^(const ByteVector& bytes) &&;
+    // Performs the AND operation between two `ByteVector` objects.
+    ByteVector operator&(const ByteVector& bytes) const &;
+    // Performs the AND operation reusing the storage of a 
+    // temporary `ByteVector`.
+    ByteVector operator&(const ByteVector& bytes) &&;
+    // Performs the OR operation between two `ByteVector` objects.
+    ByteVector operator|(const ByteVector& bytes) const &;
+    // Performs the OR operation reusing the storage of a 
+    // temporary `ByteVector`.
+    ByteVector operator|(const ByteVector& bytes) &&;
+    // Returns the complement of the current `ByteVector` object.
+    ByteVector operator~() const &;
+    // Complements a temporary `ByteVector` object in place.
+    ByteVector operator~() &&;
+    // Performs left shift bitwise operation by `n_pos` bits.
+    ByteVector operator<<(std::size_t n_pos) const &;
+    // Performs left shift on a temporary `ByteVector` by `n_pos` bits.
+    ByteVector operator<<(std::size_t n_pos) &&;
+    // Performs right shift bitwise operation by `n_pos` bits.
+    ByteVector operator>>(std::size_t n_pos) const &;
+    // Performs right shift on a temporary `ByteVector` by `n_pos` bits.
+    ByteVector operator>>(std::size_t n_pos) &&;
+    // Performs the XOR operation on the current `ByteVector` object.
+    ByteVector& operator^=(const ByteVector& bytes);
+    // Performs the AND operation on the current `ByteVector` object.
+    ByteVector& operator&=(const ByteVector& bytes);
+    // Performs the OR operation on the current `ByteVector` object.
+    ByteVector& operator|=(const ByteVector& bytes);
+    // Performs left shift on the current `ByteVector` by `n_pos` bits.
+    ByteVector& operator<<=(std::size_t n_pos);
+    // Performs right shift on the current `ByteVector` by `n_pos` bits.
+    ByteVector& operator>>=(std::size_t n_pos);
+    // Checks if two `ByteVector` objects hold the same bytes.
+    bool operator==(const ByteVector& bytes) const;
+    bool operator!=(const ByteVector& bytes) const;
+    // Compares two `ByteVector` objects lexicographically, byte by byte.
+    bool operator<(const ByteVector& bytes) const;
     // Returns the `Byte` from the position `pos`.
-    Byte operator[](const std::size_t pos) const;
+    inline Byte operator[](const std::size_t pos) const { 
+      Internal::CheckIndex(pos, bytes_.size());
+      return bytes_[pos]; 
+    }
     // Accesses the `Byte` from the position `pos`.
-    Byte& operator[](const std::size_t pos);
+    inline Byte& operator[](const std::size_t pos) { 
+      Internal::CheckIndex(pos, bytes_.size());
+      return bytes_[pos]; 
+    }
+    // Returns a pointer to the first `Byte`, for bulk access without 
+    // bounds checking.
+    inline const Byte* Data() const { return bytes_.data(); }
+    inline Byte* Data() { return bytes_.data(); }
     // Pushes back the bytes from the `Word` object.
     void PushBack(const Word& word);
     // Returns the `Word` object from the position `pos`.
@@ -171,13 +253,60 @@ class ByteVector{
     // Returns a vector of size `count` by 'Word' objects.
     std::vector<Word> GetWord(const std::size_t pos, 
                               const std::size_t count) const;
+    // Returns the position of the first `byte` starting from `from`,
+    // or `kNotFound`.
+    std::size_t Find(const Byte& byte, std::size_t from = 0) const;
+    // Returns the position of the first occurrence of `needle` starting 
+    // from `from`, or `kNotFound`. An empty `needle` is found at `from`.
+    // Needles of up to 8 bytes are filtered by their first and last 
+    // bytes, 32 positions at a time with AVX2 when the CPU supports it; 
+    // longer ones use Boyer-Moore-Horspool.
+    std::size_t Find(const ByteVector& needle, std::size_t from = 0) const;
+    // Returns the positions of all the occurrences of `needle`, 
+    // including the overlapping ones.
+    std::vector<std::size_t> FindAll(const ByteVector& needle) const;
+    // Returns the number of bytes equal to `byte`.
+    std::size_t Count(const Byte& byte) const;
+    // Returns the number of occurrences of `needle`, including 
+    // the overlapping ones.
+    std::size_t Count(const ByteVector& needle) const;
+    // Replaces every byte with the entry of the substitution `table` 
+    // that it indexes, such as the AES S-box.
+    void Substitute(const std::array<Byte, 256>& table);
+    // Reverses the bits of every byte in place, e.g. to convert 
+    // a buffer between LSB-first and MSB-first bit order.
+    void ReverseBits();
+    // Reverses the order of the bytes in place, so that the last 
+    // byte becomes the first one.
+    void ReverseBytes();
     std::string ToHex() const;
+    // Returns the Base64 representation using the given `alphabet`, 
+    // with or without the trailing `=` padding. The SSSE3 instructions 
+    // encode 12 bytes at a time when the CPU supports them.
+    std::string ToBase64(Base64Alphabet alphabet = Base64Alphabet::kStandard,
+                         bool padding = true) const;
+    // Decodes the Base64 string `base64`, padded or unpadded, into a 
+    // `ByteVector` object. Throws `std::invalid_argument` for characters 
+    // outside the `alphabet`, misplaced padding or non-zero trailing bits.
+    // The SSSE3 instructions decode 16 characters at a time when the CPU 
+    // supports them.
+    static ByteVector FromBase64(
+        const std::string& base64, 
+        Base64Alphabet alphabet = Base64Alphabet::kStandard);
     // Returns the number of bytes from the `ByteVector` object.
     inline std::size_t Size() const { return bytes_.size(); }
   private:
+    friend ByteTerminal Lazy(const ByteVector& bytes);
+    friend class SharedByteVector;
     std::vector<Byte> bytes_;
 };
 
+// Returns a copy of `bytes` with the order of the bits reversed inside 
+// every byte.
+ByteVector ReverseBits(ByteVector bytes);
+// Returns a copy of `bytes` with the order of the bytes reversed.
+ByteVector ReverseBytes(ByteVector bytes);
+
 }  // namespace ByteUtils
 
 #endif  // BYTE_UTILS_BYTE_VECTOR_H_
\ No newline at end of file
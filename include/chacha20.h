@@ -0,0 +1,75 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_CHACHA20_H_
+#define BYTE_UTILS_CHACHA20_H_
+
+#include <array>
+#include <cstdint>
+
+#include "byte_vector.h"
+#include "word.h"
+
+namespace ByteUtils {
+
+// The `ChaCha20` class generates the ChaCha20 keystream (RFC 8439) and 
+// XORs it into data, encrypting or decrypting it. Several blocks are 
+// generated at once, in lanes that the compiler maps to SIMD registers.
+// Consecutive calls continue the same keystream.
+// Example:
+//    ByteUtils::Word key("000102...1e1f", 256);
+//    ByteUtils::Word nonce("000000000000004a00000000", 96);
+//    ByteUtils::ChaCha20 cipher(key, nonce, 1);
+//    cipher.Apply(message);
+class ChaCha20 {
+  public:
+    // The number of bytes of a keystream block.
+    static constexpr std::size_t kBlockSize = 64;
+    // The number of blocks generated at once.
+    static constexpr std::size_t kLanes = 8;
+    // Initializes the cipher with a 256 bits `key`, a 96 bits `nonce` 
+    // and the number of the first block.
+    ChaCha20(const Word& key, const Word& nonce, std::uint32_t counter = 0);
+    ChaCha20(const ChaCha20& other) = default;
+    ChaCha20(ChaCha20&& other) = default;
+    ChaCha20& operator=(const ChaCha20& other) = default;
+    ChaCha20& operator=(ChaCha20&& other) = default;
+    ~ChaCha20() = default;
+    // XORs the keystream into the bytes of the `ByteVector` object.
+    void Apply(ByteVector& bytes);
+    // XORs the keystream into `size` raw bytes starting from `data`.
+    void Apply(std::uint8_t* data, std::size_t size);
+    // Returns the next `size` bytes of the keystream.
+    ByteVector Keystream(std::size_t size);
+  private:
+    // Generates the next `kLanes` blocks of keystream.
+    void Refill();
+    // The key and nonce words of the initial state.
+    std::array<std::uint32_t, 16> input_;
+    // The number of the next block to generate.
+    std::uint64_t counter_;
+    std::array<std::uint8_t, kBlockSize * kLanes> keystream_;
+    // The position of the next unused keystream byte.
+    std::size_t position_;
+    // The number of valid keystream bytes.
+    std::size_t available_;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_CHACHA20_H_
\ No newline at end of file
@@ -0,0 +1,90 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_CHECKSUM_H_
+#define BYTE_UTILS_CHECKSUM_H_
+
+#include <cstdint>
+
+#include "byte.h"
+#include "byte_vector.h"
+
+namespace ByteUtils {
+
+// The `Crc32` class computes incrementally the CRC-32 checksum 
+// (ISO-HDLC, reflected polynomial `0xedb88320`) used by zlib and PNG.
+// Example:
+//    ByteUtils::Crc32 crc;
+//    crc.Update(ByteUtils::ByteVector("313233"));
+//    crc.Update(ByteUtils::ByteVector("343536373839"));
+//    std::cout << std::hex << crc.Value();
+class Crc32 {
+  public:
+    Crc32() = default;
+    Crc32(const Crc32& other) = default;
+    Crc32(Crc32&& other) = default;
+    Crc32& operator=(const Crc32& other) = default;
+    Crc32& operator=(Crc32&& other) = default;
+    ~Crc32() = default;
+    // Returns the checksum of the `ByteVector` object.
+    static std::uint32_t Compute(const ByteVector& bytes);
+    // Adds the bytes from the `ByteVector` object to the checksum.
+    void Update(const ByteVector& bytes);
+    // Adds a `Byte` object to the checksum.
+    void Update(const Byte& byte);
+    // Adds `size` raw bytes starting from `data` to the checksum.
+    void Update(const std::uint8_t* data, std::size_t size);
+    // Returns the checksum of the bytes added so far.
+    inline std::uint32_t Value() const { return ~state_; }
+    // Restarts the checksum.
+    inline void Reset() { state_ = 0xffffffff; }
+  private:
+    std::uint32_t state_ = 0xffffffff;
+};
+
+// The `Crc32c` class computes incrementally the CRC-32C checksum 
+// (Castagnoli, reflected polynomial `0x82f63b78`) used by iSCSI and ext4.
+// The SSE4.2 `crc32` instruction is used when the CPU supports it, 
+// unless the portable paths are forced (see `cpu_features.h`).
+class Crc32c {
+  public:
+    Crc32c() = default;
+    Crc32c(const Crc32c& other) = default;
+    Crc32c(Crc32c&& other) = default;
+    Crc32c& operator=(const Crc32c& other) = default;
+    Crc32c& operator=(Crc32c&& other) = default;
+    ~Crc32c() = default;
+    // Returns the checksum of the `ByteVector` object.
+    static std::uint32_t Compute(const ByteVector& bytes);
+    // Adds the bytes from the `ByteVector` object to the checksum.
+    void Update(const ByteVector& bytes);
+    // Adds a `Byte` object to the checksum.
+    void Update(const Byte& byte);
+    // Adds `size` raw bytes starting from `data` to the checksum.
+    void Update(const std::uint8_t* data, std::size_t size);
+    // Returns the checksum of the bytes added so far.
+    inline std::uint32_t Value() const { return ~state_; }
+    // Restarts the checksum.
+    inline void Reset() { state_ = 0xffffffff; }
+  private:
+    std::uint32_t state_ = 0xffffffff;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_CHECKSUM_H_
\ No newline at end of file
@@ -0,0 +1,44 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_CPU_FEATURES_H_
+#define BYTE_UTILS_CPU_FEATURES_H_
+
+namespace ByteUtils {
+
+// Restricts the library to its portable code paths when `portable` is 
+// `true`, even on a CPU that supports the specialized instructions, e.g.
+// to test the portable paths or to compare them with the specialized 
+// ones. Passing `false` restores the detection of the CPU features. 
+// It must not be called while another thread uses the library.
+// Example:
+//    ByteUtils::UsePortableCodePaths(true);
+//    std::uint32_t crc = ByteUtils::Crc32c::Compute(bytes);
+//    ByteUtils::UsePortableCodePaths(false);
+void UsePortableCodePaths(bool portable);
+
+namespace Internal {
+
+// Checks if the library is restricted to its portable code paths.
+bool PortableCodePaths();
+
+}  // namespace Internal
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_CPU_FEATURES_H_
\ No newline at end of file
@@ -0,0 +1,107 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_HASH_H_
+#define BYTE_UTILS_HASH_H_
+
+#include <cstdint>
+#include <functional>
+
+#include "byte.h"
+#include "byte_vector.h"
+#include "word.h"
+
+namespace ByteUtils {
+
+// Returns a fast non-cryptographic 64-bit hash of `size` raw bytes 
+// starting from `data`, built on 64x64->128 bit multiply-mix rounds 
+// in the style of wyhash. Don't use it where collisions can be forced 
+// by an attacker unless the `seed` is secret.
+std::uint64_t Hash64(const std::uint8_t* data, std::size_t size, 
+                     std::uint64_t seed = 0);
+// Returns the 64-bit hash of the bytes from the `ByteVector` object.
+std::uint64_t Hash64(const ByteVector& bytes, std::uint64_t seed = 0);
+// Returns the 64-bit hash of the bytes from the `Word` object.
+std::uint64_t Hash64(const Word& word, std::uint64_t seed = 0);
+
+// The `HashedByteVector` class holds an immutable `ByteVector` object 
+// together with its hash, computed once, so hash-map lookups and 
+// inequality checks don't rescan the bytes.
+// Example:
+//    std::unordered_set<ByteUtils::HashedByteVector> keys;
+//    keys.emplace(ByteUtils::ByteVector("0a1b"));
+class HashedByteVector {
+  public:
+    explicit HashedByteVector(const ByteVector& bytes);
+    explicit HashedByteVector(ByteVector&& bytes);
+    HashedByteVector(const HashedByteVector& other) = default;
+    HashedByteVector(HashedByteVector&& other) = default;
+    HashedByteVector& operator=(const HashedByteVector& other) = default;
+    HashedByteVector& operator=(HashedByteVector&& other) = default;
+    ~HashedByteVector() = default;
+    // Compares the cached hashes before comparing the bytes.
+    inline bool operator==(const HashedByteVector& other) const {
+      return hash_ == other.hash_ && bytes_ == other.bytes_;
+    }
+    inline bool operator!=(const HashedByteVector& other) const {
+      return !(*this == other);
+    }
+    // Returns the cached hash.
+    inline std::uint64_t Hash() const { return hash_; }
+    inline const ByteVector& GetBytes() const { return bytes_; }
+  private:
+    ByteVector bytes_;
+    std::uint64_t hash_;
+};
+
+}  // namespace ByteUtils
+
+namespace std {
+
+template <>
+struct hash<ByteUtils::Byte> {
+  std::size_t operator()(const ByteUtils::Byte& byte) const noexcept {
+    return byte.ToInt();
+  }
+};
+
+template <>
+struct hash<ByteUtils::Word> {
+  std::size_t operator()(const ByteUtils::Word& word) const {
+    return ByteUtils::Hash64(word);
+  }
+};
+
+template <>
+struct hash<ByteUtils::ByteVector> {
+  std::size_t operator()(const ByteUtils::ByteVector& bytes) const {
+    return ByteUtils::Hash64(bytes);
+  }
+};
+
+template <>
+struct hash<ByteUtils::HashedByteVector> {
+  std::size_t operator()(
+      const ByteUtils::HashedByteVector& bytes) const noexcept {
+    return bytes.Hash();
+  }
+};
+
+}  // namespace std
+
+#endif  // BYTE_UTILS_HASH_H_
\ No newline at end of file
@@ -0,0 +1,86 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_HEX_BATCH_H_
+#define BYTE_UTILS_HEX_BATCH_H_
+
+#include <string>
+#include <vector>
+
+#include "shared_byte_vector.h"
+
+namespace ByteUtils {
+
+// Describes a line that couldn't be parsed by `HexBatch`.
+struct HexParseError {
+  // The zero-based index of the line.
+  std::size_t line;
+  std::string message;
+};
+
+// The `HexBatch` class parses many hexadecimal strings at once into a 
+// single contiguous arena, splitting the lines between several threads. 
+// Each line is accessed as a `SharedByteVector` view of the arena, through
+// an index of offsets. A line with an odd number of digits gets a leading 
+// `0`, as with the `ByteVector` constructor. A line that isn't valid is 
+// reported in `Errors()` and its view is empty.
+// Example:
+//    ByteUtils::HexBatch keys = ByteUtils::HexBatch::Parse(file_contents);
+//    for (const auto& error : keys.Errors()) {
+//      std::cerr << error.line << ": " << error.message << '\n';
+//    }
+//    std::cout << keys[0].ToHex();
+class HexBatch {
+  public:
+    HexBatch() = default;
+    HexBatch(const HexBatch& other) = default;
+    HexBatch(HexBatch&& other) = default;
+    HexBatch& operator=(const HexBatch& other) = default;
+    HexBatch& operator=(HexBatch&& other) = default;
+    ~HexBatch() = default;
+    // Parses the newline-delimited lines of `text` using `threads` threads,
+    // or one per core if `threads` is `0`. A trailing `\r` is ignored.
+    static HexBatch Parse(const std::string& text, std::size_t threads = 0);
+    // Parses each string of `lines` using `threads` threads, or one per 
+    // core if `threads` is `0`.
+    static HexBatch Parse(const std::vector<std::string>& lines, 
+                          std::size_t threads = 0);
+    // Returns the bytes parsed from the line `line`.
+    SharedByteVector operator[](std::size_t line) const;
+    // Returns the lines that couldn't be parsed, in order.
+    inline const std::vector<HexParseError>& Errors() const { 
+      return errors_; 
+    }
+    // Returns the arena that holds the bytes of all the lines.
+    inline const SharedByteVector& Arena() const { return arena_; }
+    // Returns the number of lines.
+    inline std::size_t Size() const { return offsets_.size() - 1; }
+  private:
+    // Parses the `size` characters of each line starting from `lines`.
+    static HexBatch Parse(const std::vector<const char*>& lines, 
+                          const std::vector<std::size_t>& sizes, 
+                          std::size_t threads);
+    SharedByteVector arena_;
+    // The line `i` starts at `offsets_[i]` and ends at `offsets_[i + 1]`.
+    std::vector<std::size_t> offsets_ = {0};
+    std::vector<HexParseError> errors_;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_HEX_BATCH_H_
\ No newline at end of file
@@ -0,0 +1,122 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_HEX_LITERAL_H_
+#define BYTE_UTILS_HEX_LITERAL_H_
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "byte.h"
+#include "byte_vector.h"
+#include "word.h"
+
+namespace ByteUtils {
+
+// The `HexLiteral` class holds the bytes of a hexadecimal literal parsed 
+// at compile time into fixed-size storage, and converts them into a `T` 
+// object, either a `ByteVector` or a `Word`, when needed. A literal with 
+// an odd number of digits gets a leading `0`. A malformed literal throws 
+// `std::invalid_argument`, which is a compile error when the literal is 
+// declared `constexpr`.
+// Example:
+//    using namespace ByteUtils::Literals;
+//    constexpr auto kKey = "2b7e151628aed2a6abf7158809cf4f3c"_bytes;
+//    ByteUtils::ByteVector key = kKey;
+template <typename T>
+class HexLiteral {
+  public:
+    // The maximum number of bytes of a literal.
+    static constexpr std::size_t kCapacity = 128;
+    // Parses the `size` hexadecimal digits from `text`.
+    constexpr HexLiteral(const char* text, std::size_t size) {
+      if (size > kCapacity * 2) {
+        throw std::invalid_argument("The hexadecimal literal is too long.");
+      }
+      std::size_t digit = 0;
+      // An odd number of digits leaves the high half of the first byte 0.
+      if (size % 2 != 0) {
+        bytes_[size_++] = Digit(text[digit++]);
+      }
+      for (; digit < size; digit += 2) {
+        bytes_[size_++] = (Digit(text[digit]) << 4) | Digit(text[digit + 1]);
+      }
+    }
+    // Returns the byte from the position `pos`.
+    constexpr Byte operator[](const std::size_t pos) const { 
+      if (pos >= size_) {
+        throw std::out_of_range("The byte is out of range.");
+      }
+      return bytes_[pos]; 
+    }
+    // Returns the size of the literal in bytes.
+    constexpr std::size_t Size() const { return size_; }
+    // Returns the literal as a `T` object.
+    operator T() const {
+      return T(std::vector<Byte>(bytes_.begin(), bytes_.begin() + size_));
+    }
+  private:
+    // Returns the value of the hexadecimal digit `c`.
+    static constexpr std::uint8_t Digit(char c) {
+      if (c >= '0' && c <= '9') {
+        return c - '0';
+      }
+      if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+      }
+      if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+      }
+      throw std::invalid_argument("Invalid character in hexadecimal literal.");
+    }
+    std::array<std::uint8_t, kCapacity> bytes_{};
+    std::size_t size_ = 0;
+};
+
+inline namespace Literals {
+
+// Returns the `Byte` from a literal of 1 or 2 hexadecimal digits, 
+// e.g. `"2b"_byte`.
+constexpr Byte operator""_byte(const char* text, std::size_t size) {
+  if (size == 0 || size > 2) {
+    throw std::invalid_argument("A byte literal has 1 or 2 hexadecimal "
+                                "digits.");
+  }
+  return HexLiteral<ByteVector>(text, size)[0];
+}
+
+// Returns the literal that converts into a `Word`, e.g. `"2b7e1516"_word`.
+constexpr HexLiteral<Word> operator""_word(const char* text, 
+                                           std::size_t size) {
+  return HexLiteral<Word>(text, size);
+}
+
+// Returns the literal that converts into a `ByteVector`, 
+// e.g. `"00112233"_bytes`.
+constexpr HexLiteral<ByteVector> operator""_bytes(const char* text, 
+                                                  std::size_t size) {
+  return HexLiteral<ByteVector>(text, size);
+}
+
+}  // namespace Literals
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_HEX_LITERAL_H_
\ No newline at end of file
@@ -0,0 +1,87 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_PIPELINE_H_
+#define BYTE_UTILS_PIPELINE_H_
+
+#include <functional>
+#include <vector>
+
+#include "byte_vector.h"
+
+namespace ByteUtils {
+
+// The `Pipeline` class streams data in bounded-size chunks from a source,
+// through a chain of transform stages, to a sink, so that only a few 
+// chunks are held in memory at once. A stage can run on its own thread:
+// it is then connected to the previous stage through a bounded queue, 
+// which blocks the faster stage when it gets ahead (backpressure). The 
+// first exception thrown by the source, a stage or the sink stops the 
+// pipeline and is rethrown by `Run`.
+// Example:
+//    ByteUtils::ByteVectorReader reader(input_fd);
+//    ByteUtils::Crc32c crc;
+//    ByteUtils::ByteVectorBuilder output;
+//    ByteUtils::Pipeline(
+//        [&reader](ByteUtils::ByteVector& chunk) { 
+//          return reader.Next(chunk); 
+//        })
+//      .Then([&cipher](ByteUtils::ByteVector& chunk) { 
+//          cipher.Apply(chunk); 
+//        }, true)
+//      .Then([&crc](ByteUtils::ByteVector& chunk) { crc.Update(chunk); })
+//      .Run([&output](const ByteUtils::ByteVector& chunk) { 
+//          output.Append(chunk); 
+//        });
+class Pipeline {
+  public:
+    // Fills the next chunk and returns `true`, or returns `false` when 
+    // the input is exhausted.
+    using Source = std::function<bool(ByteVector&)>;
+    // Transforms a chunk in place; the chunk can be resized or replaced.
+    using Transform = std::function<void(ByteVector&)>;
+    // Consumes a transformed chunk.
+    using Sink = std::function<void(const ByteVector&)>;
+    // Initializes the pipeline with the `source` of the chunks. Each queue 
+    // between threads holds at most `queue_capacity` chunks.
+    explicit Pipeline(Source source, std::size_t queue_capacity = 4);
+    Pipeline(const Pipeline& other) = default;
+    Pipeline(Pipeline&& other) = default;
+    Pipeline& operator=(const Pipeline& other) = default;
+    Pipeline& operator=(Pipeline&& other) = default;
+    ~Pipeline() = default;
+    // Appends a stage that applies `transform` to every chunk, on its own 
+    // thread if `own_thread` is `true` or on the thread of the previous
+    // stage otherwise.
+    Pipeline& Then(Transform transform, bool own_thread = false);
+    // Pulls all the chunks through the stages into `sink`, which runs on 
+    // the calling thread, and returns when the source is exhausted.
+    void Run(const Sink& sink);
+  private:
+    struct Stage {
+      Transform transform;
+      bool own_thread;
+    };
+    Source source_;
+    std::vector<Stage> stages_;
+    std::size_t queue_capacity_;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_PIPELINE_H_
\ No newline at end of file
@@ -0,0 +1,55 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_RADIX_SORT_H_
+#define BYTE_UTILS_RADIX_SORT_H_
+
+#include <vector>
+
+#include "byte_vector.h"
+
+namespace ByteUtils {
+
+// Sorts `keys` in the lexicographic order of `ByteVector::operator<` using
+// an MSD radix sort, which looks at every byte of a key at most once per
+// level instead of comparing common prefixes again and again.
+// Example:
+//    std::vector<ByteUtils::ByteVector> keys = LoadKeys();
+//    ByteUtils::RadixSort(keys);
+//    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+void RadixSort(std::vector<ByteVector>& keys);
+
+// Sorts `keys` like `RadixSort` on `threads` threads, or one per core if 
+// `threads` is `0`. The keys are distributed by their leading bytes until
+// every bucket is small enough to be a task of its own, so keys with long 
+// common prefixes are also spread between the threads. If a thread can't 
+// be started, the tasks are finished by the threads that are running.
+void ParallelRadixSort(std::vector<ByteVector>& keys, std::size_t threads = 0);
+
+namespace Internal {
+
+// Returns the sizes of the buckets that `ParallelRadixSort` sorts as 
+// independent tasks on `threads` threads, largest first.
+std::vector<std::size_t> ParallelSortTasks(const std::vector<ByteVector>& keys,
+                                           std::size_t threads);
+
+}  // namespace Internal
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_RADIX_SORT_H_
\ No newline at end of file
@@ -0,0 +1,143 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_SERIALIZATION_H_
+#define BYTE_UTILS_SERIALIZATION_H_
+
+#include <cstdint>
+#include <memory>
+#include <ostream>
+#include <vector>
+
+#include "byte.h"
+#include "byte_stream.h"
+#include "byte_vector.h"
+#include "shared_byte_vector.h"
+#include "word.h"
+
+namespace ByteUtils {
+
+// The integrity check appended to every serialized record.
+enum class Checksum {
+  kNone,
+  // The CRC-32C of the record bytes, stored as 4 little-endian bytes.
+  kCrc32c
+};
+
+// The `BinaryWriter` class serializes `ByteVector` and `Word` objects and 
+// collections of them in a compact binary format. Each record is the 
+// LEB128 varint length followed by the raw bytes and, optionally, by their
+// checksum. A collection is the varint number of records followed by the 
+// records.
+// Example:
+//    ByteUtils::BinaryWriter writer(ByteUtils::Checksum::kCrc32c);
+//    writer.Write(ByteUtils::ByteVector("0a1b2c"));
+//    writer.Write(ByteUtils::Word("1a1b1c1d"));
+//    writer.WriteTo(fd);
+class BinaryWriter {
+  public:
+    explicit BinaryWriter(Checksum checksum = Checksum::kNone);
+    BinaryWriter(const BinaryWriter& other) = default;
+    BinaryWriter(BinaryWriter&& other) = default;
+    BinaryWriter& operator=(const BinaryWriter& other) = default;
+    BinaryWriter& operator=(BinaryWriter&& other) = default;
+    ~BinaryWriter() = default;
+    // Writes the bytes from the `ByteVector` object as a record.
+    void Write(const ByteVector& bytes);
+    // Writes the bytes from the `Word` object as a record.
+    void Write(const Word& word);
+    // Writes the viewed bytes as a record.
+    void Write(const SharedByteVector& bytes);
+    // Writes a collection of `ByteVector` objects.
+    void Write(const std::vector<ByteVector>& collection);
+    // Writes a collection of `Word` objects.
+    void Write(const std::vector<Word>& collection);
+    // Returns a `ByteVector` object with all the serialized bytes.
+    inline ByteVector Build() const { return builder_.Build(); }
+    // Writes all the serialized bytes to the file descriptor `fd`.
+    inline void WriteTo(int fd) const { builder_.WriteTo(fd); }
+    // Writes all the serialized bytes to `stream`.
+    inline void WriteTo(std::ostream& stream) const { 
+      builder_.WriteTo(stream); 
+    }
+    // Removes all the serialized bytes.
+    inline void Clear() { builder_.Clear(); }
+    // Returns the number of serialized bytes.
+    inline std::size_t Size() const { return builder_.Size(); }
+  private:
+    // Appends the length, the bytes and the checksum of a record.
+    void WriteRecord(const Byte* data, std::size_t size);
+    // Appends `value` as an LEB128 varint.
+    void WriteVarint(std::uint64_t value);
+    ByteVectorBuilder builder_;
+    Checksum checksum_;
+};
+
+// The `BinaryReader` class deserializes the records written by 
+// `BinaryWriter`. The records are returned as `SharedByteVector` views 
+// of the read buffer, so no bytes are copied. When reading from a file 
+// descriptor, the input is consumed in chunks as the records are read; 
+// each chunk becomes the read buffer without copying, but a record that 
+// spans chunks is copied, with the rest of its last chunk, into a new 
+// buffer. A larger `chunk_size` makes such copies rarer.
+// Example:
+//    ByteUtils::BinaryReader reader(fd, ByteUtils::Checksum::kCrc32c);
+//    ByteUtils::SharedByteVector record;
+//    while (reader.Next(record)) {
+//      std::cout << record.ToHex();
+//    }
+class BinaryReader {
+  public:
+    // Reads the records from `buffer`.
+    explicit BinaryReader(const SharedByteVector& buffer, 
+                          Checksum checksum = Checksum::kNone);
+    // Reads the records from the file descriptor `fd` in chunks of 
+    // at least `chunk_size` bytes.
+    explicit BinaryReader(int fd, Checksum checksum = Checksum::kNone, 
+                          std::size_t chunk_size = 64 * 1024);
+    BinaryReader(const BinaryReader& other) = delete;
+    BinaryReader(BinaryReader&& other) = default;
+    BinaryReader& operator=(const BinaryReader& other) = delete;
+    BinaryReader& operator=(BinaryReader&& other) = default;
+    ~BinaryReader() = default;
+    // Reads the next record into `record`. Returns `false` when the 
+    // input is exhausted.
+    bool Next(SharedByteVector& record);
+    // Returns the next record as a view.
+    SharedByteVector ReadBytes();
+    // Returns the next record as a `ByteVector` object.
+    ByteVector ReadByteVector();
+    // Returns the next record as a `Word` object.
+    Word ReadWord();
+    // Returns the records of the next collection as views.
+    std::vector<SharedByteVector> ReadCollection();
+  private:
+    // Makes at least `size` unread bytes available in `buffer_`, reading 
+    // more input if needed. Returns `false` if the input ends before.
+    bool Ensure(std::size_t size);
+    // Reads an LEB128 varint.
+    std::uint64_t ReadVarint();
+    std::unique_ptr<ByteVectorReader> source_;
+    SharedByteVector buffer_;
+    std::size_t position_ = 0;
+    Checksum checksum_;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_SERIALIZATION_H_
\ No newline at end of file
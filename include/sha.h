@@ -0,0 +1,102 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_SHA_H_
+#define BYTE_UTILS_SHA_H_
+
+#include <array>
+#include <cstdint>
+#include <istream>
+
+#include "byte_vector.h"
+
+namespace ByteUtils {
+
+// The `Sha256` class computes incrementally the SHA-256 digest 
+// (FIPS 180-4). The x86 SHA extensions are used when the CPU supports them.
+// Example:
+//    ByteUtils::Sha256 sha;
+//    sha.Update(ByteUtils::ByteVector("616263"));
+//    std::cout << sha.Finalize().ToHex();
+class Sha256 {
+  public:
+    // The number of bytes of the digest.
+    static constexpr std::size_t kDigestSize = 32;
+    // The number of bytes of a message block.
+    static constexpr std::size_t kBlockSize = 64;
+    Sha256();
+    Sha256(const Sha256& other) = default;
+    Sha256(Sha256&& other) = default;
+    Sha256& operator=(const Sha256& other) = default;
+    Sha256& operator=(Sha256&& other) = default;
+    ~Sha256() = default;
+    // Returns the digest of the `ByteVector` object.
+    static ByteVector Compute(const ByteVector& bytes);
+    // Adds the bytes from the `ByteVector` object to the message.
+    void Update(const ByteVector& bytes);
+    // Adds `size` raw bytes starting from `data` to the message.
+    void Update(const std::uint8_t* data, std::size_t size);
+    // Adds the bytes read from `stream` until its end to the message.
+    void Update(std::istream& stream);
+    // Returns the digest of the message and restarts the computation.
+    ByteVector Finalize();
+    // Restarts the computation.
+    void Reset();
+  private:
+    std::array<std::uint32_t, 8> state_;
+    std::array<std::uint8_t, kBlockSize> buffer_;
+    std::size_t buffered_;
+    std::uint64_t length_;
+};
+
+// The `Sha512` class computes incrementally the SHA-512 digest 
+// (FIPS 180-4).
+class Sha512 {
+  public:
+    // The number of bytes of the digest.
+    static constexpr std::size_t kDigestSize = 64;
+    // The number of bytes of a message block.
+    static constexpr std::size_t kBlockSize = 128;
+    Sha512();
+    Sha512(const Sha512& other) = default;
+    Sha512(Sha512&& other) = default;
+    Sha512& operator=(const Sha512& other) = default;
+    Sha512& operator=(Sha512&& other) = default;
+    ~Sha512() = default;
+    // Returns the digest of the `ByteVector` object.
+    static ByteVector Compute(const ByteVector& bytes);
+    // Adds the bytes from the `ByteVector` object to the message.
+    void Update(const ByteVector& bytes);
+    // Adds `size` raw bytes starting from `data` to the message.
+    void Update(const std::uint8_t* data, std::size_t size);
+    // Adds the bytes read from `stream` until its end to the message.
+    void Update(std::istream& stream);
+    // Returns the digest of the message and restarts the computation.
+    ByteVector Finalize();
+    // Restarts the computation.
+    void Reset();
+  private:
+    std::array<std::uint64_t, 8> state_;
+    std::array<std::uint8_t, kBlockSize> buffer_;
+    std::size_t buffered_;
+    std::uint64_t length_;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_SHA_H_
\ No newline at end of file
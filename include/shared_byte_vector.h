@@ -0,0 +1,105 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_SHARED_BYTE_VECTOR_H_
+#define BYTE_UTILS_SHARED_BYTE_VECTOR_H_
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "byte.h"
+#include "byte_vector.h"
+
+namespace ByteUtils {
+
+// The `SharedByteVector` class is a reference-counted, read-mostly view 
+// of a range of bytes. Slicing shares the underlying buffer in O(1) time;
+// the bytes are copied only when a shared view is modified (copy-on-write).
+// Views of the same buffer can be read from multiple threads, since reads 
+// never modify the buffer and the reference count is atomic. Modifying a 
+// view (`Set`, `Substitute`, assignment) requires external synchronization 
+// with every thread that uses the same view object.
+// Example:
+//    ByteUtils::SharedByteVector packet(ByteUtils::ByteVector("0a1b2c3d"));
+//    ByteUtils::SharedByteVector header = packet.Slice(0, 2);
+//    std::cout << header.ToHex();
+class SharedByteVector {
+  public:
+    SharedByteVector();
+    // Takes a copy of the bytes from the `ByteVector` object.
+    explicit SharedByteVector(const ByteVector& bytes);
+    // Takes over the bytes from the `ByteVector` object without copying.
+    explicit SharedByteVector(ByteVector&& bytes);
+    SharedByteVector(const SharedByteVector& other) = default;
+    SharedByteVector(SharedByteVector&& other) = default;
+    SharedByteVector& operator=(const SharedByteVector& other) = default;
+    SharedByteVector& operator=(SharedByteVector&& other) = default;
+    ~SharedByteVector() = default;
+    // Returns the `ConstIterator` that points to the first `Byte` 
+    // of the view.
+    ByteVector::ConstIterator begin() const { 
+      return ByteVector::ConstIterator(*buffer_, offset_); 
+    }
+    // Returns the `ConstIterator` that points past the last `Byte` 
+    // of the view.
+    ByteVector::ConstIterator end() const { 
+      return ByteVector::ConstIterator(*buffer_, offset_ + size_); 
+    }
+    // Returns the `Byte` from the position `pos`. Reading never copies 
+    // the viewed bytes.
+    inline Byte operator[](const std::size_t pos) const { 
+      Internal::CheckIndex(pos, size_);
+      return (*buffer_)[offset_ + pos]; 
+    }
+    // Replaces the `Byte` from the position `pos` with `byte`, copying 
+    // the viewed bytes first if the buffer is shared.
+    void Set(const std::size_t pos, const Byte& byte);
+    // Returns a pointer to the first `Byte` of the view.
+    inline const Byte* Data() const { return buffer_->data() + offset_; }
+    // Replaces every viewed byte with the entry of the substitution 
+    // `table` that it indexes, copying the viewed bytes first if the 
+    // buffer is shared.
+    void Substitute(const std::array<Byte, 256>& table);
+    // Returns a view of `length` bytes starting from `offset` that 
+    // shares the same buffer.
+    SharedByteVector Slice(std::size_t offset, std::size_t length) const;
+    // Returns a copy of the viewed bytes.
+    ByteVector ToByteVector() const;
+    std::string ToHex() const;
+    // Checks if the buffer is referenced by other views. The result is 
+    // only a snapshot when other threads copy or destroy views of the 
+    // same buffer.
+    inline bool IsShared() const { return buffer_.use_count() > 1; }
+    // Returns the number of bytes from the view.
+    inline std::size_t Size() const { return size_; }
+  private:
+    SharedByteVector(std::shared_ptr<std::vector<Byte>> buffer, 
+                     std::size_t offset, std::size_t size);
+    // Gives the view its own copy of the viewed bytes, unless it is the 
+    // only view of the buffer.
+    void DetachIfShared();
+    std::shared_ptr<std::vector<Byte>> buffer_;
+    std::size_t offset_ = 0;
+    std::size_t size_ = 0;
+};
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_SHARED_BYTE_VECTOR_H_
\ No newline at end of file
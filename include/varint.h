@@ -0,0 +1,65 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_VARINT_H_
+#define BYTE_UTILS_VARINT_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "byte_vector.h"
+
+namespace ByteUtils {
+
+// The maximum number of bytes of an LEB128 encoded 32-bit value.
+constexpr std::size_t kMaxVarint32Size = 5;
+// The maximum number of bytes of an LEB128 encoded 64-bit value.
+constexpr std::size_t kMaxVarint64Size = 10;
+
+// Writes `value` as an unsigned LEB128 varint at `out`, which must have
+// room for `kMaxVarint64Size` bytes, and returns the number of bytes 
+// written.
+std::size_t EncodeVarint(std::uint64_t value, std::uint8_t* out);
+
+// Returns the unsigned LEB128 encoding of all the `values`.
+// Example:
+//    ByteUtils::ByteVector bytes = ByteUtils::EncodeVarints(values);
+//    std::vector<std::uint32_t> decoded;
+//    ByteUtils::DecodeVarints(bytes, decoded);
+ByteVector EncodeVarints(const std::vector<std::uint32_t>& values);
+ByteVector EncodeVarints(const std::vector<std::uint64_t>& values);
+
+// Decodes `size` bytes of consecutive unsigned LEB128 varints starting 
+// from `data` and appends them to `values`. Throws `std::runtime_error` if 
+// a varint is truncated or doesn't fit in the type of `values`. The SSSE3 
+// `pshufb` instruction is used when the CPU supports it.
+void DecodeVarints(const std::uint8_t* data, std::size_t size, 
+                   std::vector<std::uint32_t>& values);
+void DecodeVarints(const std::uint8_t* data, std::size_t size, 
+                   std::vector<std::uint64_t>& values);
+
+// Decodes the unsigned LEB128 varints from the `ByteVector` object and 
+// appends them to `values`.
+void DecodeVarints(const ByteVector& bytes, 
+                   std::vector<std::uint32_t>& values);
+void DecodeVarints(const ByteVector& bytes, 
+                   std::vector<std::uint64_t>& values);
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_VARINT_H_
\ No newline at end of file
@@ -19,6 +19,7 @@
 #ifndef BYTE_UTILS_WORD_H_
 #define BYTE_UTILS_WORD_H_
 
+#include <array>
 #include <cstdint>
 #include <ostream>
 #include <string>
@@ -28,6 +29,11 @@
 
 namespace ByteUtils {
 
+class ByteTerminal;
+
+template <typename Expression>
+class ByteExpression;
+
 // The `Word` class manage and performs bitwise operations on 
 // 'N' bits of data, treated as a single entity. The rightmost bit 
 // represents the LSB and the leftmost bit represents the MSB. 
@@ -130,10 +136,17 @@ class Word {
     Word(std::int64_t decimal_value, std::size_t bits = 32);
     // Initializes the `Word` object with an array of `Byte` objects.
     Word(const std::vector<Byte>& word);
+    // Evaluates the lazy `expression` in a single pass.
+    // See `byte_expression.h`.
+    template <typename Expression>
+    Word(const ByteExpression<Expression>& expression);
     Word(const Word& other) = default;
     Word(Word&& other) = default;
     Word& operator=(const Word& other) = default;
     Word& operator=(Word&& other) = default;
+    // Evaluates the lazy `expression` in a single pass.
+    template <typename Expression>
+    Word& operator=(const ByteExpression<Expression>& expression);
     ~Word() = default;
     // Prints the `Word` object as an array of bits.
     friend std::ostream& operator<<(std::ostream& stream, const Word& data);
@@ -164,33 +177,109 @@ class Word {
       return ConstReverseIterator(word_, -1); 
     }
     // Performs the XOR operation between two `Word` objects.
-    Word operator^(const Word& word) const;
+    Word operator^(const Word& word) const &;
+    // Performs the XOR operation reusing the storage of a temporary `Word`.
+    Word operator^(const Word& word) &&;
     // Performs the XOR operation between `Word` and `Byte` objects.
-    Word operator^(const Byte& byte) const;
+    Word operator^(const Byte& byte) const &;
+    // Performs the XOR operation between a temporary `Word` and a `Byte`.
+    Word operator^(const Byte& byte) &&;
     // Performs the AND operation between two `Word` objects.
-    Word operator&(const Word& word) const; 
+    Word operator&(const Word& word) const &; 
+    // Performs the AND operation reusing the storage of a temporary `Word`.
+    Word operator&(const Word& word) &&;
     // Performs the OR operation between two `Word` objects.
-    Word operator|(const Word& word) const;
+    Word operator|(const Word& word) const &;
+    // Performs the OR operation reusing the storage of a temporary `Word`.
+    Word operator|(const Word& word) &&;
     // Returns the complement of the current `Word` object.
-    Word operator~() const;
+    Word operator~() const &;
+    // Complements a temporary `Word` object in place.
+    Word operator~() &&;
     // Performs left shift bitwise operation by `n_pos` bits.
-    Word operator<<(std::size_t n_pos) const;
+    Word operator<<(std::size_t n_pos) const &;
+    // Performs left shift on a temporary `Word` object by `n_pos` bits.
+    Word operator<<(std::size_t n_pos) &&;
     // Performs right shift bitwise operation by `n_pos` bits.
-    Word operator>>(std::size_t n_pos) const;
+    Word operator>>(std::size_t n_pos) const &;
+    // Performs right shift on a temporary `Word` object by `n_pos` bits.
+    Word operator>>(std::size_t n_pos) &&;
+    // Performs the addition modulo 2^N between two `Word` objects.
+    Word operator+(const Word& word) const &;
+    // Performs the addition modulo 2^N reusing the storage of 
+    // a temporary `Word`.
+    Word operator+(const Word& word) &&;
+    // Performs the subtraction modulo 2^N between two `Word` objects.
+    Word operator-(const Word& word) const &;
+    // Performs the subtraction modulo 2^N reusing the storage of 
+    // a temporary `Word`.
+    Word operator-(const Word& word) &&;
+    // Returns the `Word` object rotated towards the MSB by `n_pos` bits.
+    Word RotateLeft(std::size_t n_pos) const;
+    // Returns the `Word` object rotated towards the LSB by `n_pos` bits.
+    Word RotateRight(std::size_t n_pos) const;
+    // Performs the addition modulo 2^N on the current `Word` object.
+    Word& operator+=(const Word& word);
+    // Performs the subtraction modulo 2^N on the current `Word` object.
+    Word& operator-=(const Word& word);
+    // Performs the XOR operation on the current `Word` object.
+    Word& operator^=(const Word& word);
+    // Performs the XOR operation with a `Byte` on every byte of 
+    // the current `Word` object.
+    Word& operator^=(const Byte& byte);
+    // Performs the AND operation on the current `Word` object.
+    Word& operator&=(const Word& word);
+    // Performs the OR operation on the current `Word` object.
+    Word& operator|=(const Word& word);
+    // Performs left shift on the current `Word` object by `n_pos` bits.
+    Word& operator<<=(std::size_t n_pos);
+    // Performs right shift on the current `Word` object by `n_pos` bits.
+    Word& operator>>=(std::size_t n_pos);
+    // Checks if two `Word` objects hold the same bytes.
+    bool operator==(const Word& word) const;
+    bool operator!=(const Word& word) const;
+    // Compares two `Word` objects lexicographically, byte by byte.
+    bool operator<(const Word& word) const;
     // Returns a byte from position `pos`.
-    Byte operator[](const std::size_t pos) const;
+    inline Byte operator[](const std::size_t pos) const { 
+      Internal::CheckIndex(pos, word_.size());
+      return word_[pos]; 
+    }
     // Accesses the byte from the position `pos`.
-    Byte& operator[](const std::size_t pos);
+    inline Byte& operator[](const std::size_t pos) { 
+      Internal::CheckIndex(pos, word_.size());
+      return word_[pos]; 
+    }
+    // Returns a pointer to the first byte, for bulk access without 
+    // bounds checking.
+    inline const Byte* Data() const { return word_.data(); }
+    inline Byte* Data() { return word_.data(); }
     // Pushes back a `Byte` object.
     void PushBack(const Byte& byte);
+    // Replaces every byte with the entry of the substitution `table` 
+    // that it indexes, such as the AES S-box.
+    void Substitute(const std::array<Byte, 256>& table);
+    // Reverses the bits of each byte of the word; the bytes 
+    // keep their positions.
+    void ReverseBits();
+    // Reverses the byte order of the word, e.g. to read a word 
+    // stored in little-endian order.
+    void ReverseBytes();
     std::string ToHex() const;
     // Returns the size of `Word` object in bytes.
     inline const std::size_t Size() const { return word_.size(); }
     inline const std::vector<Byte> GetWord() const { return word_; }
   private:
+    friend ByteTerminal Lazy(const Word& word);
     std::vector<Byte> word_;
 };
 
+// Returns a copy of `word` with the order of the bits reversed inside 
+// every byte.
+Word ReverseBits(Word word);
+// Returns a copy of `word` with the order of the bytes reversed.
+Word ReverseBytes(Word word);
+
 }  // namespace ByteUtils
 
 #endif  // BYTE_UTILS_WORD_H_
\ No newline at end of file
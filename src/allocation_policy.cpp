@@ -0,0 +1,141 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "allocation_policy.h"
+
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace ByteUtils {
+
+namespace Internal {
+
+namespace {
+
+#if defined(__linux__)
+
+// Returns the CPUs of the NUMA node `node`, read from its `cpulist` file
+// with entries such as `0-3,8,10-11`.
+cpu_set_t NodeCpus(int node) {
+  std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + 
+                     "/cpulist");
+  std::string list;
+  if (node < 0 || !std::getline(file, list)) {
+    throw std::invalid_argument("The NUMA node " + std::to_string(node) + 
+                                " doesn't exist.");
+  }
+  cpu_set_t cpus;
+  CPU_ZERO(&cpus);
+  std::stringstream stream(list);
+  std::string range;
+  while (std::getline(stream, range, ',')) {
+    if (range.empty()) {
+      continue;
+    }
+    std::size_t dash = range.find('-');
+    int first = std::stoi(range.substr(0, dash));
+    int last = dash == std::string::npos ? first 
+                                         : std::stoi(range.substr(dash + 1));
+    for (int cpu = first; cpu <= last && cpu < CPU_SETSIZE; cpu++) {
+      CPU_SET(cpu, &cpus);
+    }
+  }
+  return cpus;
+}
+
+// Advises the kernel to use huge pages for the whole pages inside 
+// `size` bytes starting from `data`.
+void AdviseHugePages(void* data, std::size_t size) {
+  const std::uintptr_t page = sysconf(_SC_PAGESIZE);
+  std::uintptr_t begin = (reinterpret_cast<std::uintptr_t>(data) + page - 1) & 
+                         ~(page - 1);
+  std::uintptr_t end = (reinterpret_cast<std::uintptr_t>(data) + size) & 
+                       ~(page - 1);
+  if (begin < end) {
+    // The advice is only a hint, so a kernel without transparent huge 
+    // pages simply keeps the regular pages.
+    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+  }
+}
+
+// The `AffinityGuard` class pins the calling thread to a set of CPUs and 
+// restores its previous CPU affinity when it goes out of scope, even if 
+// an exception is thrown in between.
+class AffinityGuard {
+  public:
+    explicit AffinityGuard(const cpu_set_t& cpus) {
+      pinned_ = sched_getaffinity(0, sizeof(previous_), &previous_) == 0 && 
+                sched_setaffinity(0, sizeof(cpus), &cpus) == 0;
+    }
+    AffinityGuard(const AffinityGuard& other) = delete;
+    AffinityGuard& operator=(const AffinityGuard& other) = delete;
+    ~AffinityGuard() {
+      if (pinned_) {
+        sched_setaffinity(0, sizeof(previous_), &previous_);
+      }
+    }
+  private:
+    cpu_set_t previous_;
+    bool pinned_ = false;
+};
+
+// Reserves `size` bytes, applies the huge page advice and then faults 
+// the pages in.
+void ReserveAndResize(std::vector<Byte>& bytes, std::size_t size, 
+                      bool huge_pages) {
+  // Reserving leaves the pages untouched, so the advice applies before 
+  // the pages are faulted in.
+  bytes.reserve(size);
+  if (huge_pages && size > 0) {
+    AdviseHugePages(bytes.data(), size * sizeof(Byte));
+  }
+  bytes.resize(size);
+}
+
+#endif
+
+}  // namespace
+
+void AllocateBytes(std::vector<Byte>& bytes, std::size_t size, 
+                   const AllocationPolicy& policy) {
+#if defined(__linux__)
+  if (policy.numa_node != -1) {
+    // The pages are faulted in by a CPU of the node, so the kernel 
+    // places them in the memory of the node.
+    AffinityGuard guard(NodeCpus(policy.numa_node));
+    ReserveAndResize(bytes, size, policy.huge_pages);
+    return;
+  }
+  ReserveAndResize(bytes, size, policy.huge_pages);
+#else
+  bytes.resize(size);
+#endif
+}
+
+}  // namespace Internal
+
+}  // namespace ByteUtils
\ No newline at end of file
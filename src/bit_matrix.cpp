@@ -0,0 +1,242 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "bit_matrix.h"
+
+#include <stdexcept>
+#include <vector>
+
+#include "cpu_features.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define BYTE_UTILS_HAS_AVX2_TRANSPOSE 1
+#endif
+
+namespace ByteUtils {
+
+namespace {
+
+// Transposes the 8x8 tiles of the rows `8 * first_tile_row` onwards of 
+// the bit matrix `source` into `result`.
+void TransposeTiles(const std::uint8_t* source, std::size_t rows, 
+                    std::size_t row_bytes, std::size_t first_tile_row, 
+                    std::vector<Byte>& result) {
+  const std::size_t result_row_bytes = rows / 8;
+  // Transposes each 8x8 tile and places it at the mirrored position.
+  for (std::size_t tile_row = first_tile_row; tile_row < rows / 8; 
+       tile_row++) {
+    for (std::size_t tile_column = 0; tile_column < row_bytes; tile_column++) {
+      std::uint64_t tile = 0;
+      for (std::size_t row = 0; row < 8; row++) {
+        tile = (tile << 8) | 
+               source[(tile_row * 8 + row) * row_bytes + tile_column];
+      }
+      tile = Transpose8x8(tile);
+      for (std::size_t row = 0; row < 8; row++) {
+        result[(tile_column * 8 + row) * result_row_bytes + tile_row] = 
+            static_cast<std::uint8_t>(tile >> (56 - row * 8));
+      }
+    }
+  }
+}
+
+#ifdef BYTE_UTILS_HAS_AVX2_TRANSPOSE
+// Transposes the rows of `source` 32 at a time: the bytes of a column 
+// from 32 rows are loaded into a register, whose `vpmovmskb` gathers 
+// their MSBs into one 32-bit row of the result; shifting every byte left 
+// brings the next bit of the column to the MSB. Returns the number of 
+// 8-row tiles that were transposed.
+__attribute__((target("avx2")))
+std::size_t TransposeAvx2(const std::uint8_t* source, std::size_t rows, 
+                          std::size_t row_bytes, std::vector<Byte>& result) {
+  const std::size_t result_row_bytes = rows / 8;
+  alignas(32) std::uint8_t column[32];
+  std::size_t group = 0;
+  for (; group + 32 <= rows; group += 32) {
+    for (std::size_t tile_column = 0; tile_column < row_bytes; tile_column++) {
+      // The first row goes to the last byte, so that its bit is the MSB 
+      // of the mask.
+      for (std::size_t row = 0; row < 32; row++) {
+        column[31 - row] = source[(group + row) * row_bytes + tile_column];
+      }
+      __m256i bytes = _mm256_load_si256(
+          reinterpret_cast<const __m256i*>(column));
+      for (std::size_t bit = 0; bit < 8; bit++) {
+        std::uint32_t mask = _mm256_movemask_epi8(bytes);
+        Byte* row = &result[(tile_column * 8 + bit) * result_row_bytes + 
+                            group / 8];
+        row[0] = static_cast<std::uint8_t>(mask >> 24);
+        row[1] = static_cast<std::uint8_t>(mask >> 16);
+        row[2] = static_cast<std::uint8_t>(mask >> 8);
+        row[3] = static_cast<std::uint8_t>(mask);
+        bytes = _mm256_add_epi8(bytes, bytes);
+      }
+    }
+  }
+  return group / 8;
+}
+
+const bool kHasAvx2 = __builtin_cpu_supports("avx2");
+#endif
+
+}  // namespace
+
+std::uint64_t Transpose8x8(std::uint64_t matrix) {
+  // Swaps the 1x1, then the 2x2 and finally the 4x4 blocks 
+  // across the diagonal.
+  std::uint64_t t = (matrix ^ (matrix >> 7)) & 0x00aa00aa00aa00aa;
+  matrix ^= t ^ (t << 7);
+  t = (matrix ^ (matrix >> 14)) & 0x0000cccc0000cccc;
+  matrix ^= t ^ (t << 14);
+  t = (matrix ^ (matrix >> 28)) & 0x00000000f0f0f0f0;
+  matrix ^= t ^ (t << 28);
+  return matrix;
+}
+
+void Transpose64x64(std::array<std::uint64_t, 64>& matrix) {
+  // Swaps the 32x32 blocks across the diagonal, then recursively the 
+  // smaller blocks inside each of them, with `mask` selecting the 
+  // right half of the blocks of size `width`.
+  std::uint64_t mask = 0x00000000ffffffff;
+  for (std::size_t width = 32; width != 0; width >>= 1, 
+                                           mask ^= mask << width) {
+    for (std::size_t row = 0; row < 64; row = ((row | width) + 1) & ~width) {
+      std::uint64_t t = (matrix[row] ^ (matrix[row | width] >> width)) & mask;
+      matrix[row] ^= t;
+      matrix[row | width] ^= t << width;
+    }
+  }
+}
+
+ByteVector TransposeBits(const ByteVector& block, std::size_t rows) {
+  if (rows == 0 || rows % 8 != 0 || block.Size() % rows != 0) {
+    throw std::invalid_argument("The number of rows must be a multiple of 8 "
+                                "that divides the block size.");
+  }
+  const std::size_t row_bytes = block.Size() / rows;
+  std::vector<std::uint8_t> source;
+  source.reserve(block.Size());
+  for (const auto& byte : block) {
+    source.push_back(byte.ToInt());
+  }
+  std::vector<Byte> result(block.Size());
+  std::size_t first_tile_row = 0;
+#ifdef BYTE_UTILS_HAS_AVX2_TRANSPOSE
+  if (kHasAvx2 && !Internal::PortableCodePaths()) {
+    first_tile_row = TransposeAvx2(source.data(), rows, row_bytes, result);
+  }
+#endif
+  TransposeTiles(source.data(), rows, row_bytes, first_tile_row, result);
+  return ByteVector(std::move(result));
+}
+
+BitslicedBytes::BitslicedBytes(const ByteVector& bytes) {
+  if (bytes.Size() > kLanes) {
+    throw std::invalid_argument("At most 64 bytes can be bitsliced.");
+  }
+  std::uint8_t lanes[kLanes] = {};
+  std::size_t index = 0;
+  for (const auto& byte : bytes) {
+    lanes[index++] = byte.ToInt();
+  }
+  // Each group of 8 lanes is an 8x8 matrix whose transpose gives 
+  // one byte of every plane. The lane `8 * group + row` is loaded into 
+  // the byte `row` counted from the least significant one, so that it 
+  // lands in the bit `8 * group + row` of the planes.
+  for (std::size_t group = 0; group < 8; group++) {
+    std::uint64_t tile = 0;
+    for (std::size_t row = 0; row < 8; row++) {
+      tile |= std::uint64_t(lanes[group * 8 + row]) << (row * 8);
+    }
+    tile = Transpose8x8(tile);
+    for (std::size_t bit = 0; bit < 8; bit++) {
+      planes_[bit] |= ((tile >> (bit * 8)) & 0xff) << (group * 8);
+    }
+  }
+}
+
+BitslicedBytes BitslicedBytes::operator^(const BitslicedBytes& other) const {
+  BitslicedBytes result = *this;
+  result ^= other;
+  return result;
+}
+
+BitslicedBytes BitslicedBytes::operator&(const BitslicedBytes& other) const {
+  BitslicedBytes result;
+  for (std::size_t bit = 0; bit < 8; bit++) {
+    result.planes_[bit] = planes_[bit] & other.planes_[bit];
+  }
+  return result;
+}
+
+BitslicedBytes BitslicedBytes::operator|(const BitslicedBytes& other) const {
+  BitslicedBytes result;
+  for (std::size_t bit = 0; bit < 8; bit++) {
+    result.planes_[bit] = planes_[bit] | other.planes_[bit];
+  }
+  return result;
+}
+
+BitslicedBytes BitslicedBytes::operator~() const {
+  BitslicedBytes result;
+  for (std::size_t bit = 0; bit < 8; bit++) {
+    result.planes_[bit] = ~planes_[bit];
+  }
+  return result;
+}
+
+BitslicedBytes& BitslicedBytes::operator^=(const BitslicedBytes& other) {
+  for (std::size_t bit = 0; bit < 8; bit++) {
+    planes_[bit] ^= other.planes_[bit];
+  }
+  return *this;
+}
+
+Byte BitslicedBytes::Lane(std::size_t lane) const {
+  if (lane >= kLanes) {
+    throw std::out_of_range("The lane " + std::to_string(lane) + 
+                            " is out of range.");
+  }
+  std::uint8_t value = 0;
+  for (std::size_t bit = 0; bit < 8; bit++) {
+    value |= ((planes_[bit] >> lane) & 1) << bit;
+  }
+  return value;
+}
+
+ByteVector BitslicedBytes::ToByteVector(std::size_t count) const {
+  if (count > kLanes) {
+    throw std::out_of_range("At most 64 lanes can be returned.");
+  }
+  std::vector<Byte> bytes;
+  bytes.reserve(count);
+  for (std::size_t group = 0; group * 8 < count; group++) {
+    std::uint64_t tile = 0;
+    for (std::size_t bit = 0; bit < 8; bit++) {
+      tile |= ((planes_[bit] >> (group * 8)) & 0xff) << (bit * 8);
+    }
+    tile = Transpose8x8(tile);
+    for (std::size_t row = 0; row < 8 && group * 8 + row < count; row++) {
+      bytes.emplace_back(static_cast<std::uint8_t>(tile >> (row * 8)));
+    }
+  }
+  return ByteVector(std::move(bytes));
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
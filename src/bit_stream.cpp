@@ -0,0 +1,188 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "bit_stream.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace ByteUtils {
+
+namespace {
+
+// The largest field that can be peeked after a refill, since the buffer 
+// is refilled with whole bytes.
+constexpr std::size_t kMaxPeek = 57;
+
+// Returns a mask of the `n_bits` low bits, for `n_bits` below 64.
+inline std::uint64_t LowMask(std::size_t n_bits) {
+  return (std::uint64_t(1) << n_bits) - 1;
+}
+
+}  // namespace
+
+BitReader::BitReader(const ByteVector& bytes, BitOrder order)
+    : data_(bytes.Data()), 
+      size_(bytes.Size()), order_(order) {}
+
+BitReader::BitReader(const SharedByteVector& bytes, BitOrder order)
+    : owner_(bytes), data_(bytes.Data()), size_(bytes.Size()), 
+      order_(order) {}
+
+void BitReader::Refill() {
+  if (order_ == BitOrder::kMsbFirst) {
+    while (count_ <= 56 && position_ < size_) {
+      buffer_ |= std::uint64_t(data_[position_++].ToInt()) << (56 - count_);
+      count_ += 8;
+    }
+  } else {
+    while (count_ <= 56 && position_ < size_) {
+      buffer_ |= std::uint64_t(data_[position_++].ToInt()) << count_;
+      count_ += 8;
+    }
+  }
+}
+
+void BitReader::Require(std::size_t n_bits) const {
+  if (n_bits > BitsLeft()) {
+    throw std::out_of_range("Can't read " + std::to_string(n_bits) + 
+                            " bits, only " + std::to_string(BitsLeft()) + 
+                            " bits are left.");
+  }
+}
+
+std::uint64_t BitReader::Peek(std::size_t n_bits) {
+  if (n_bits > kMaxPeek) {
+    throw std::invalid_argument("At most 57 bits can be peeked.");
+  }
+  if (count_ < n_bits) {
+    Refill();
+    Require(n_bits);
+  }
+  if (n_bits == 0) {
+    return 0;
+  }
+  return order_ == BitOrder::kMsbFirst ? buffer_ >> (64 - n_bits) 
+                                       : buffer_ & LowMask(n_bits);
+}
+
+void BitReader::Skip(std::size_t n_bits) {
+  Require(n_bits);
+  while (n_bits > 0) {
+    if (count_ == 0) {
+      Refill();
+    }
+    std::size_t step = std::min(n_bits, count_);
+    // A shift by 64 bits is undefined, so a full buffer is just dropped.
+    if (step == 64) {
+      buffer_ = 0;
+    } else if (order_ == BitOrder::kMsbFirst) {
+      buffer_ <<= step;
+    } else {
+      buffer_ >>= step;
+    }
+    count_ -= step;
+    n_bits -= step;
+  }
+}
+
+std::uint64_t BitReader::Read(std::size_t n_bits) {
+  if (n_bits > 64) {
+    throw std::invalid_argument("At most 64 bits can be read at once.");
+  }
+  if (n_bits <= kMaxPeek) {
+    std::uint64_t value = Peek(n_bits);
+    Skip(n_bits);
+    return value;
+  }
+  Require(n_bits);
+  // Splits wide fields in two reads that fit in the buffer.
+  std::uint64_t high = Read(32);
+  std::uint64_t low = Read(n_bits - 32);
+  return order_ == BitOrder::kMsbFirst ? (high << (n_bits - 32)) | low 
+                                       : high | (low << 32);
+}
+
+void BitReader::AlignToByte() {
+  Skip(count_ % 8);
+}
+
+BitWriter::BitWriter(BitOrder order): order_(order) {}
+
+void BitWriter::Write(std::uint64_t value, std::size_t n_bits) {
+  if (n_bits > 64) {
+    throw std::invalid_argument("At most 64 bits can be written at once.");
+  }
+  // Splits wide fields so that the pending bits always fit in the buffer.
+  if (n_bits > kMaxPeek) {
+    if (order_ == BitOrder::kMsbFirst) {
+      Write(value >> 32, n_bits - 32);
+      Write(value & LowMask(32), 32);
+    } else {
+      Write(value & LowMask(32), 32);
+      Write(value >> 32, n_bits - 32);
+    }
+    return;
+  }
+  if (n_bits == 0) {
+    return;
+  }
+  value &= LowMask(n_bits);
+  if (order_ == BitOrder::kMsbFirst) {
+    buffer_ = (buffer_ << n_bits) | value;
+  } else {
+    buffer_ |= value << count_;
+  }
+  count_ += n_bits;
+  Flush();
+}
+
+void BitWriter::Flush() {
+  if (order_ == BitOrder::kMsbFirst) {
+    while (count_ >= 8) {
+      count_ -= 8;
+      bytes_.emplace_back(static_cast<std::uint8_t>(buffer_ >> count_));
+    }
+    buffer_ &= LowMask(count_);
+  } else {
+    while (count_ >= 8) {
+      bytes_.emplace_back(static_cast<std::uint8_t>(buffer_));
+      buffer_ >>= 8;
+      count_ -= 8;
+    }
+  }
+}
+
+void BitWriter::AlignToByte() {
+  if (count_ % 8 != 0) {
+    Write(0, 8 - count_ % 8);
+  }
+}
+
+ByteVector BitWriter::Finish() {
+  AlignToByte();
+  ByteVector bytes(std::move(bytes_));
+  bytes_.clear();
+  buffer_ = 0;
+  count_ = 0;
+  return bytes;
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
@@ -18,15 +18,31 @@
 */
 #include "byte.h"
 
+#include <array>
 #include <iomanip>
 #include <exception>
 #include <sstream>
 
 namespace ByteUtils {
 
-Byte::Byte(const std::bitset<8>& byte): byte_(byte) {}
+namespace {
 
-Byte::Byte(const std::uint8_t data): byte_(data) {}
+// Builds the table that maps every byte to its bit-reversed value.
+constexpr std::array<std::uint8_t, 256> MakeReverseTable() {
+  std::array<std::uint8_t, 256> table{};
+  for (std::size_t value = 0; value < 256; value++) {
+    std::uint8_t reversed = 0;
+    for (std::size_t bit = 0; bit < 8; bit++) {
+      reversed |= ((value >> bit) & 1) << (7 - bit);
+    }
+    table[value] = reversed;
+  }
+  return table;
+}
+
+constexpr std::array<std::uint8_t, 256> kReverseTable = MakeReverseTable();
+
+}  // namespace
 
 Byte::Byte(const std::string& data, const uint8_t base) {
   if (base != 2 && base != 16) {
@@ -55,41 +71,6 @@ std::ostream& operator<<(std::ostream& stream, const std::bitset<8>::reference b
   return stream;
 }
 
-Byte Byte::operator&(const Byte& data) const {
-  return byte_ & data.byte_;
-}
-
-Byte Byte::operator|(const Byte& data) const {
-  return byte_ | data.byte_;
-}
-
-Byte Byte::operator^(const Byte& data) const {
-  return byte_ ^ data.byte_;
-}
-
-Byte& Byte::operator^=(const Byte& data) {
-  byte_ ^= data.byte_;
-  return *this;
-}
-
-Byte Byte::operator~() const {
-  return ~byte_;
-}
-
-Byte Byte::operator<<(const std::size_t n_pos) const {
-  return byte_ << n_pos;
-}
-
-Byte& Byte::operator<<=(const std::size_t n_pos) {
-  byte_ <<= n_pos;
-  return *this;
-}
-
-Byte& Byte::operator>>=(const std::size_t n_pos) {
-  byte_ >>= n_pos;
-  return *this;
-}
-
 Byte Byte::operator*(const Byte& byte) const {
   Byte result;
   Byte byte1(byte_);
@@ -112,20 +93,23 @@ Byte Byte::operator*(const Byte& byte) const {
   return result ;
 }
 
-bool Byte::operator[](const std::size_t pos) const {
-  if (pos > 7) {
-    throw std::out_of_range("The bit from position " + std::to_string(pos) + 
-                            " is out of range.");
-  }
-  return byte_[pos];
+namespace Internal {
+
+void ThrowOutOfRange(std::size_t pos, std::size_t size) {
+  throw std::out_of_range("The position " + std::to_string(pos) + 
+                          " is out of range for " + std::to_string(size) + 
+                          " elements.");
 }
 
-std::bitset<8>::reference Byte::operator[](const std::size_t pos) {
-  if (pos > 7) {
-    throw std::out_of_range("The bit from position " + std::to_string(pos) + 
-                            " is out of range.");
-  }
-  return byte_[pos];
+}  // namespace Internal
+
+void Byte::ReverseBits() {
+  byte_ = kReverseTable[byte_.to_ulong()];
+}
+
+Byte ReverseBits(Byte byte) {
+  byte.ReverseBits();
+  return byte;
 }
 
 std::string Byte::ToHex() const {
@@ -0,0 +1,60 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_BYTE_BLOCKS_H_
+#define BYTE_UTILS_BYTE_BLOCKS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+
+#include "byte.h"
+#include "byte_vector.h"
+
+namespace ByteUtils {
+
+namespace Internal {
+
+// Number of bytes copied at once into a raw buffer by `ForEachBlock`.
+constexpr std::size_t kCopyBlockSize = 4096;
+
+// Copies `size` bytes starting from `data` into a raw buffer, one block 
+// at a time, and calls `function` with each block and its length.
+template <typename Function>
+void ForEachBlock(const Byte* data, std::size_t size, Function function) {
+  std::uint8_t block[kCopyBlockSize];
+  for (std::size_t offset = 0; offset < size; offset += kCopyBlockSize) {
+    std::size_t length = std::min(kCopyBlockSize, size - offset);
+    for (std::size_t index = 0; index < length; index++) {
+      block[index] = data[offset + index].ToInt();
+    }
+    function(block, length);
+  }
+}
+
+// Calls `function` with the bytes of `bytes`, copied one block at a time.
+template <typename Function>
+void ForEachBlock(const ByteVector& bytes, Function function) {
+  ForEachBlock(bytes.Data(), bytes.Size(), function);
+}
+
+}  // namespace Internal
+
+}  // namespace ByteUtils
+
+#endif  // BYTE_UTILS_BYTE_BLOCKS_H_
\ No newline at end of file
@@ -0,0 +1,90 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "byte_rope.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace ByteUtils {
+
+ByteRope::ByteRope(const SharedByteVector& bytes) {
+  Append(bytes);
+}
+
+Byte ByteRope::operator[](const std::size_t pos) const {
+  Internal::CheckIndex(pos, size_);
+  // Finds the last chunk that begins at or before `pos`.
+  std::ptrdiff_t offset = origin_ + static_cast<std::ptrdiff_t>(pos);
+  auto chunk = std::upper_bound(offsets_.begin(), offsets_.end(), offset) - 1;
+  std::size_t chunk_index = chunk - offsets_.begin();
+  return chunks_[chunk_index].Data()[offset - *chunk];
+}
+
+void ByteRope::Append(const SharedByteVector& bytes) {
+  chunks_.push_back(bytes);
+  offsets_.push_back(origin_ + static_cast<std::ptrdiff_t>(size_));
+  size_ += bytes.Size();
+}
+
+void ByteRope::Append(ByteVector&& bytes) {
+  Append(SharedByteVector(std::move(bytes)));
+}
+
+void ByteRope::Append(const ByteRope& rope) {
+  // Copies the chunk list first, since `rope` can be this object.
+  std::deque<SharedByteVector> chunks = rope.chunks_;
+  for (const auto& chunk : chunks) {
+    Append(chunk);
+  }
+}
+
+void ByteRope::Prepend(const SharedByteVector& bytes) {
+  chunks_.push_front(bytes);
+  origin_ -= static_cast<std::ptrdiff_t>(bytes.Size());
+  offsets_.push_front(origin_);
+  size_ += bytes.Size();
+}
+
+void ByteRope::Prepend(ByteVector&& bytes) {
+  Prepend(SharedByteVector(std::move(bytes)));
+}
+
+void ByteRope::Prepend(const ByteRope& rope) {
+  std::deque<SharedByteVector> chunks = rope.chunks_;
+  for (auto chunk = chunks.rbegin(); chunk != chunks.rend(); ++chunk) {
+    Prepend(*chunk);
+  }
+}
+
+ByteRope ByteRope::operator+(const ByteRope& rope) const {
+  ByteRope result = *this;
+  result.Append(rope);
+  return result;
+}
+
+ByteVector ByteRope::Flatten() const {
+  std::vector<Byte> bytes;
+  bytes.reserve(size_);
+  for (const auto& chunk : chunks_) {
+    bytes.insert(bytes.end(), chunk.Data(), chunk.Data() + chunk.Size());
+  }
+  return ByteVector(std::move(bytes));
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
@@ -0,0 +1,206 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "byte_search.h"
+
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+
+#include "byte_blocks.h"
+#include "cpu_features.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define BYTE_UTILS_HAS_AVX2_PREFILTER 1
+#endif
+
+namespace ByteUtils {
+
+namespace {
+
+constexpr std::uint32_t kNoState = static_cast<std::uint32_t>(-1);
+
+// The most distinct first bytes of the patterns tested by the prefilter.
+constexpr std::size_t kMaxPrefilterBytes = 4;
+
+#ifdef BYTE_UTILS_HAS_AVX2_PREFILTER
+// Returns the first position from `index` of `block` that holds one of 
+// the `starts`, or `length`. Compares 32 bytes at a time with every 
+// byte of `starts` using `vpcmpeqb`.
+__attribute__((target("avx2")))
+std::size_t SkipToStartAvx2(const std::uint8_t* block, std::size_t index, 
+                            std::size_t length, 
+                            const std::vector<std::uint8_t>& starts) {
+  __m256i needles[kMaxPrefilterBytes];
+  for (std::size_t start = 0; start < starts.size(); start++) {
+    needles[start] = _mm256_set1_epi8(static_cast<char>(starts[start]));
+  }
+  for (; index + 32 <= length; index += 32) {
+    __m256i bytes = _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(block + index));
+    __m256i matches = _mm256_setzero_si256();
+    for (std::size_t start = 0; start < starts.size(); start++) {
+      matches = _mm256_or_si256(matches, 
+                                _mm256_cmpeq_epi8(bytes, needles[start]));
+    }
+    std::uint32_t mask = _mm256_movemask_epi8(matches);
+    if (mask != 0) {
+      return index + __builtin_ctz(mask);
+    }
+  }
+  for (; index < length; index++) {
+    if (std::find(starts.begin(), starts.end(), block[index]) != 
+        starts.end()) {
+      return index;
+    }
+  }
+  return length;
+}
+
+const bool kHasAvx2 = __builtin_cpu_supports("avx2");
+#endif
+
+}  // namespace
+
+MultiPatternSearcher::MultiPatternSearcher(
+    const std::vector<ByteVector>& patterns) {
+  // Builds the trie of the patterns.
+  transitions_.assign(256, kNoState);
+  outputs_.emplace_back();
+  for (std::size_t pattern = 0; pattern < patterns.size(); pattern++) {
+    if (patterns[pattern].Size() == 0) {
+      throw std::invalid_argument("The patterns can't be empty.");
+    }
+    std::uint32_t state = 0;
+    for (const auto& byte : patterns[pattern]) {
+      std::uint32_t& next = transitions_[state * 256 + byte.ToInt()];
+      if (next == kNoState) {
+        next = static_cast<std::uint32_t>(outputs_.size());
+        transitions_.resize(transitions_.size() + 256, kNoState);
+        outputs_.emplace_back();
+      }
+      state = transitions_[state * 256 + byte.ToInt()];
+    }
+    outputs_[state].push_back(pattern);
+    sizes_.push_back(patterns[pattern].Size());
+  }
+  // Completes the transitions in breadth-first order, so every missing 
+  // transition follows the one of the longest proper suffix.
+  std::vector<std::uint32_t> fail(outputs_.size(), 0);
+  std::queue<std::uint32_t> states;
+  for (std::size_t byte = 0; byte < 256; byte++) {
+    std::uint32_t& next = transitions_[byte];
+    if (next == kNoState) {
+      next = 0;
+    } else {
+      states.push(next);
+    }
+  }
+  while (!states.empty()) {
+    std::uint32_t state = states.front();
+    states.pop();
+    const std::vector<std::size_t>& suffix_outputs = outputs_[fail[state]];
+    outputs_[state].insert(outputs_[state].end(), suffix_outputs.begin(), 
+                           suffix_outputs.end());
+    for (std::size_t byte = 0; byte < 256; byte++) {
+      std::uint32_t& next = transitions_[state * 256 + byte];
+      std::uint32_t fallback = transitions_[fail[state] * 256 + byte];
+      if (next == kNoState) {
+        next = fallback;
+      } else {
+        fail[next] = fallback;
+        states.push(next);
+      }
+    }
+  }
+  for (std::size_t byte = 0; byte < 256; byte++) {
+    if (transitions_[byte] != 0) {
+      starts_.push_back(static_cast<std::uint8_t>(byte));
+    }
+  }
+}
+
+std::size_t MultiPatternSearcher::SkipToStart(const std::uint8_t* block, 
+                                              std::size_t index, 
+                                              std::size_t length) const {
+#ifdef BYTE_UTILS_HAS_AVX2_PREFILTER
+  if (starts_.size() <= kMaxPrefilterBytes && kHasAvx2 && 
+      !Internal::PortableCodePaths()) {
+    return SkipToStartAvx2(block, index, length, starts_);
+  }
+#endif
+  while (index < length && Next(0, block[index]) == 0) {
+    ++index;
+  }
+  return index;
+}
+
+std::vector<MultiPatternSearcher::Match> MultiPatternSearcher::FindAll(
+    const ByteVector& haystack) const {
+  std::vector<Match> matches;
+  std::uint32_t state = 0;
+  std::size_t offset = 0;
+  Internal::ForEachBlock(haystack, [&](const std::uint8_t* block, 
+                                       std::size_t length) {
+    std::size_t index = 0;
+    while (index < length) {
+      // No pattern can end before a byte that starts one is read.
+      if (state == 0) {
+        index = SkipToStart(block, index, length);
+        if (index == length) {
+          break;
+        }
+      }
+      state = Next(state, block[index++]);
+      for (const auto& pattern : outputs_[state]) {
+        matches.push_back({offset + index - sizes_[pattern], pattern});
+      }
+    }
+    offset += length;
+  });
+  return matches;
+}
+
+bool MultiPatternSearcher::ContainsAny(const ByteVector& haystack) const {
+  bool found = false;
+  std::uint32_t state = 0;
+  for (std::size_t offset = 0; offset < haystack.Size() && !found; 
+       offset += Internal::kCopyBlockSize) {
+    std::size_t size = std::min(Internal::kCopyBlockSize, 
+                                haystack.Size() - offset);
+    Internal::ForEachBlock(haystack.Data() + offset, size, 
+                           [&](const std::uint8_t* block, 
+                               std::size_t length) {
+      std::size_t index = 0;
+      while (index < length && !found) {
+        if (state == 0) {
+          index = SkipToStart(block, index, length);
+          if (index == length) {
+            break;
+          }
+        }
+        state = Next(state, block[index++]);
+        found = !outputs_[state].empty();
+      }
+    });
+  }
+  return found;
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
@@ -0,0 +1,183 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "byte_stream.h"
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <stdexcept>
+#include <system_error>
+#include <utility>
+
+namespace ByteUtils {
+
+ByteVectorBuilder::ByteVectorBuilder(std::size_t chunk_size)
+    : chunk_size_(chunk_size) {
+  if (chunk_size_ == 0) {
+    throw std::invalid_argument("The chunk size must be greater than 0.");
+  }
+}
+
+void ByteVectorBuilder::Append(const Byte& byte) {
+  CurrentChunk().push_back(byte.ToInt());
+  ++size_;
+}
+
+void ByteVectorBuilder::Append(const Word& word) {
+  for (const auto& byte : word) {
+    Append(byte);
+  }
+}
+
+void ByteVectorBuilder::Append(const ByteVector& bytes) {
+  for (const auto& byte : bytes) {
+    Append(byte);
+  }
+}
+
+void ByteVectorBuilder::Append(const std::uint8_t* data, std::size_t size) {
+  while (size > 0) {
+    std::vector<std::uint8_t>& chunk = CurrentChunk();
+    std::size_t count = std::min(size, chunk_size_ - chunk.size());
+    chunk.insert(chunk.end(), data, data + count);
+    data += count;
+    size -= count;
+    size_ += count;
+  }
+}
+
+ByteVector ByteVectorBuilder::Build() const {
+  std::vector<Byte> bytes;
+  bytes.reserve(size_);
+  for (const auto& chunk : chunks_) {
+    bytes.insert(bytes.end(), chunk.begin(), chunk.end());
+  }
+  return ByteVector(std::move(bytes));
+}
+
+void ByteVectorBuilder::WriteTo(int fd) const {
+  std::vector<iovec> buffers;
+  buffers.reserve(chunks_.size());
+  for (const auto& chunk : chunks_) {
+    iovec buffer;
+    buffer.iov_base = const_cast<std::uint8_t*>(chunk.data());
+    buffer.iov_len = chunk.size();
+    buffers.push_back(buffer);
+  }
+  std::size_t index = 0;
+  while (index < buffers.size()) {
+    int count = static_cast<int>(std::min<std::size_t>(buffers.size() - index, 
+                                                       IOV_MAX));
+    ssize_t written = ::writev(fd, &buffers[index], count);
+    if (written < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::system_error(errno, std::generic_category(), 
+                              "Can't write the bytes");
+    }
+    // Skips the fully written buffers and adjusts a partially written one.
+    std::size_t remaining = written;
+    while (index < buffers.size() && remaining >= buffers[index].iov_len) {
+      remaining -= buffers[index].iov_len;
+      ++index;
+    }
+    if (remaining > 0) {
+      buffers[index].iov_base = 
+          static_cast<std::uint8_t*>(buffers[index].iov_base) + remaining;
+      buffers[index].iov_len -= remaining;
+    }
+  }
+}
+
+void ByteVectorBuilder::WriteTo(std::ostream& stream) const {
+  for (const auto& chunk : chunks_) {
+    stream.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+  }
+  if (!stream) {
+    throw std::runtime_error("Can't write the bytes to the stream.");
+  }
+}
+
+void ByteVectorBuilder::Clear() {
+  chunks_.clear();
+  size_ = 0;
+}
+
+std::vector<std::uint8_t>& ByteVectorBuilder::CurrentChunk() {
+  if (chunks_.empty() || chunks_.back().size() == chunk_size_) {
+    chunks_.emplace_back();
+    chunks_.back().reserve(chunk_size_);
+  }
+  return chunks_.back();
+}
+
+ByteVectorReader::ByteVectorReader(int fd, std::size_t chunk_size)
+    : fd_(fd), chunk_size_(chunk_size), buffer_(chunk_size) {
+  if (chunk_size_ == 0) {
+    throw std::invalid_argument("The chunk size must be greater than 0.");
+  }
+}
+
+ByteVectorReader::ByteVectorReader(std::istream& stream, 
+                                   std::size_t chunk_size)
+    : stream_(&stream), chunk_size_(chunk_size), buffer_(chunk_size) {
+  if (chunk_size_ == 0) {
+    throw std::invalid_argument("The chunk size must be greater than 0.");
+  }
+}
+
+bool ByteVectorReader::Next(ByteVector& chunk) {
+  std::size_t size = Read(buffer_.data(), chunk_size_);
+  if (size == 0) {
+    return false;
+  }
+  chunk = ByteVector(std::vector<Byte>(buffer_.begin(), 
+                                       buffer_.begin() + size));
+  return true;
+}
+
+std::size_t ByteVectorReader::Read(std::uint8_t* data, std::size_t size) {
+  if (stream_ != nullptr) {
+    stream_->read(reinterpret_cast<char*>(data), size);
+    return stream_->gcount();
+  }
+  // Fills the whole chunk unless the end of the input is reached.
+  std::size_t total = 0;
+  while (total < size) {
+    ssize_t count = ::read(fd_, data + total, size - total);
+    if (count < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      throw std::system_error(errno, std::generic_category(), 
+                              "Can't read the bytes");
+    }
+    if (count == 0) {
+      break;
+    }
+    total += count;
+  }
+  return total;
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
@@ -19,15 +19,321 @@
 #include "byte_vector.h"
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 #include <regex>
 
+#include "allocation_policy.h"
+#include "byte_blocks.h"
+#include "cpu_features.h"
 #include "word.h"
 
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define BYTE_UTILS_HAS_SSSE3_BASE64 1
+#define BYTE_UTILS_HAS_AVX2_SEARCH 1
+#endif
+
 namespace ByteUtils {
 
+namespace {
+
+constexpr char kBase64Standard[] = 
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+constexpr char kBase64UrlSafe[] = 
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+// Marks the characters that don't belong to a Base64 alphabet.
+constexpr std::uint8_t kBase64Invalid = 0xff;
+
+// Builds the table that maps a character to its 6-bit value.
+constexpr std::array<std::uint8_t, 256> MakeBase64DecodeTable(
+    const char* alphabet) {
+  std::array<std::uint8_t, 256> table{};
+  for (auto& value : table) {
+    value = kBase64Invalid;
+  }
+  for (std::uint8_t index = 0; index < 64; index++) {
+    table[static_cast<unsigned char>(alphabet[index])] = index;
+  }
+  return table;
+}
+
+constexpr std::array<std::uint8_t, 256> kBase64StandardDecode = 
+    MakeBase64DecodeTable(kBase64Standard);
+constexpr std::array<std::uint8_t, 256> kBase64UrlSafeDecode = 
+    MakeBase64DecodeTable(kBase64UrlSafe);
+
+#ifdef BYTE_UTILS_HAS_SSSE3_BASE64
+// Encodes 12 bytes at a time into 16 characters: `pshufb` spreads each 
+// group of 3 bytes over a 32-bit lane, the multiplications move its 
+// 4 sextets into separate bytes and a `pshufb` lookup adds to each 
+// sextet the offset of its range in the alphabet `symbols`. Reads 16 
+// bytes per step and returns the number of bytes encoded.
+__attribute__((target("ssse3")))
+std::size_t EncodeBase64Ssse3(const std::uint8_t* data, std::size_t size, 
+                              const char* symbols, char* out) {
+  const __m128i spread = _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 
+                                       7, 6, 8, 7, 10, 9, 11, 10);
+  const __m128i offsets = _mm_setr_epi8(
+      'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, 
+      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, 
+      static_cast<char>(symbols[62] - 62), static_cast<char>(symbols[63] - 63),
+      'A', 0, 0);
+  std::size_t index = 0;
+  for (; index + 16 <= size; index += 12, out += 16) {
+    __m128i bytes = _mm_shuffle_epi8(_mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(data + index)), spread);
+    // Moves the sextets `a` and `c` of each lane to the low bits of 
+    // their bytes, then the sextets `b` and `d`.
+    __m128i sextets = _mm_or_si128(
+        _mm_mulhi_epu16(_mm_and_si128(bytes, _mm_set1_epi32(0x0fc0fc00)), 
+                        _mm_set1_epi32(0x04000040)),
+        _mm_mullo_epi16(_mm_and_si128(bytes, _mm_set1_epi32(0x003f03f0)), 
+                        _mm_set1_epi32(0x01000010)));
+    // Selects the offset: 13 for `A-Z`, 0 for `a-z`, 1 to 10 for the 
+    // digits and 11 or 12 for the last two symbols.
+    __m128i range = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+    range = _mm_or_si128(range, _mm_and_si128(
+        _mm_cmpgt_epi8(_mm_set1_epi8(26), sextets), _mm_set1_epi8(13)));
+    __m128i chars = _mm_add_epi8(sextets, _mm_shuffle_epi8(offsets, range));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out), chars);
+  }
+  return index;
+}
+
+// Decodes 16 characters at a time into 12 bytes: the ranges of the 
+// alphabet `symbols` are matched with comparisons, and `pmaddubsw` and 
+// `pmaddwd` pack the sextets of each 32-bit lane into 3 bytes. Stops 
+// before the first 16 characters that hold an invalid one and returns 
+// the number of characters decoded.
+__attribute__((target("ssse3")))
+std::size_t DecodeBase64Ssse3(const char* base64, std::size_t size, 
+                              const char* symbols, std::vector<Byte>& bytes) {
+  const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 
+                                     14, 13, 12, -1, -1, -1, -1);
+  std::size_t index = 0;
+  for (; index + 16 <= size; index += 16) {
+    __m128i chars = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(base64 + index));
+    __m128i upper = _mm_and_si128(
+        _mm_cmpgt_epi8(chars, _mm_set1_epi8('A' - 1)), 
+        _mm_cmpgt_epi8(_mm_set1_epi8('Z' + 1), chars));
+    __m128i lower = _mm_and_si128(
+        _mm_cmpgt_epi8(chars, _mm_set1_epi8('a' - 1)), 
+        _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), chars));
+    __m128i digit = _mm_and_si128(
+        _mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), 
+        _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chars));
+    __m128i symbol62 = _mm_cmpeq_epi8(chars, _mm_set1_epi8(symbols[62]));
+    __m128i symbol63 = _mm_cmpeq_epi8(chars, _mm_set1_epi8(symbols[63]));
+    __m128i valid = _mm_or_si128(_mm_or_si128(upper, lower), 
+                                 _mm_or_si128(digit, 
+                                 _mm_or_si128(symbol62, symbol63)));
+    if (_mm_movemask_epi8(valid) != 0xffff) {
+      break;
+    }
+    __m128i offset = _mm_or_si128(
+        _mm_or_si128(_mm_and_si128(upper, _mm_set1_epi8(-'A')), 
+                     _mm_and_si128(lower, _mm_set1_epi8(26 - 'a'))), 
+        _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+    // The last two symbols are replaced with their values.
+    __m128i sextets = _mm_or_si128(
+        _mm_andnot_si128(_mm_or_si128(symbol62, symbol63), 
+                         _mm_add_epi8(chars, offset)), 
+        _mm_or_si128(_mm_and_si128(symbol62, _mm_set1_epi8(62)), 
+                     _mm_and_si128(symbol63, _mm_set1_epi8(63))));
+    __m128i pairs = _mm_maddubs_epi16(sextets, _mm_set1_epi32(0x01400140));
+    __m128i groups = _mm_madd_epi16(pairs, _mm_set1_epi32(0x00011000));
+    alignas(16) std::uint8_t decoded[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(decoded), 
+                    _mm_shuffle_epi8(groups, pack));
+    bytes.insert(bytes.end(), decoded, decoded + 12);
+  }
+  return index;
+}
+
+const bool kHasSsse3 = __builtin_cpu_supports("ssse3");
+#endif
+
+// Encodes the groups of 3 bytes from `data` into `out` and returns 
+// the number of bytes encoded.
+std::size_t EncodeBase64Groups(const std::uint8_t* data, std::size_t size, 
+                               const char* symbols, char* out) {
+  std::size_t index = 0;
+#ifdef BYTE_UTILS_HAS_SSSE3_BASE64
+  if (kHasSsse3 && !Internal::PortableCodePaths()) {
+    index = EncodeBase64Ssse3(data, size, symbols, out);
+    out += index / 3 * 4;
+  }
+#endif
+  for (; index + 3 <= size; index += 3) {
+    std::uint32_t group = (data[index] << 16) | (data[index+1] << 8) | 
+                          data[index+2];
+    *out++ = symbols[(group >> 18) & 0x3f];
+    *out++ = symbols[(group >> 12) & 0x3f];
+    *out++ = symbols[(group >> 6) & 0x3f];
+    *out++ = symbols[group & 0x3f];
+  }
+  return index;
+}
+
+// Needles longer than this are searched with Boyer-Moore-Horspool.
+constexpr std::size_t kShortNeedle = 8;
+
+// Checks if the `size` bytes from `a` and `b` are equal.
+bool Equal(const Byte* a, const Byte* b, std::size_t size) {
+  for (std::size_t index = 0; index < size; index++) {
+    if (a[index] != b[index]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Searches a short needle by testing its first and last bytes before 
+// comparing the bytes between them.
+std::size_t FindShort(const Byte* haystack, std::size_t size, 
+                      const Byte* needle, std::size_t needle_size,
+                      std::size_t from) {
+  const Byte& first = needle[0];
+  const Byte& last = needle[needle_size-1];
+  for (std::size_t pos = from; pos + needle_size <= size; pos++) {
+    if (haystack[pos] == first && haystack[pos+needle_size-1] == last &&
+        (needle_size <= 2 || 
+         Equal(haystack + pos + 1, needle + 1, needle_size - 2))) {
+      return pos;
+    }
+  }
+  return ByteVector::kNotFound;
+}
+
+#ifdef BYTE_UTILS_HAS_AVX2_SEARCH
+// Number of bytes gathered for the first block searched by `FindShortAvx2`;
+// the next blocks double up to `Internal::kCopyBlockSize`, so a match 
+// close to `from` doesn't copy a whole block.
+constexpr std::size_t kFirstSearchBlock = 64;
+
+// Returns the first of the `windows` positions of `block` where the raw 
+// `needle` starts, or `ByteVector::kNotFound`. The first and last bytes 
+// of 32 windows are tested at a time with `vpcmpeqb`, and only the 
+// windows that match both are compared in full.
+__attribute__((target("avx2")))
+std::size_t FindInBlockAvx2(const std::uint8_t* block, std::size_t windows, 
+                            const std::uint8_t* needle, 
+                            std::size_t needle_size) {
+  const __m256i first = _mm256_set1_epi8(static_cast<char>(needle[0]));
+  const __m256i last = _mm256_set1_epi8(
+      static_cast<char>(needle[needle_size-1]));
+  std::size_t pos = 0;
+  for (; pos + 32 <= windows; pos += 32) {
+    __m256i first_matches = _mm256_cmpeq_epi8(first, _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(block + pos)));
+    __m256i last_matches = _mm256_cmpeq_epi8(last, _mm256_loadu_si256(
+        reinterpret_cast<const __m256i*>(block + pos + needle_size - 1)));
+    std::uint32_t candidates = _mm256_movemask_epi8(
+        _mm256_and_si256(first_matches, last_matches));
+    while (candidates != 0) {
+      std::size_t candidate = pos + __builtin_ctz(candidates);
+      if (needle_size <= 2 || std::memcmp(block + candidate + 1, needle + 1, 
+                                          needle_size - 2) == 0) {
+        return candidate;
+      }
+      candidates &= candidates - 1;
+    }
+  }
+  for (; pos < windows; pos++) {
+    if (block[pos] == needle[0] && 
+        block[pos+needle_size-1] == needle[needle_size-1] &&
+        (needle_size <= 2 || 
+         std::memcmp(block + pos + 1, needle + 1, needle_size - 2) == 0)) {
+      return pos;
+    }
+  }
+  return ByteVector::kNotFound;
+}
+
+// Searches a short needle in blocks gathered by `Internal::ForEachBlock`, 
+// which overlap by `needle_size - 1` bytes so that no window is missed.
+std::size_t FindShortAvx2(const Byte* haystack, std::size_t size, 
+                          const Byte* needle, std::size_t needle_size,
+                          std::size_t from) {
+  std::uint8_t raw_needle[kShortNeedle];
+  for (std::size_t index = 0; index < needle_size; index++) {
+    raw_needle[index] = needle[index].ToInt();
+  }
+  std::size_t found = ByteVector::kNotFound;
+  std::size_t block_size = kFirstSearchBlock;
+  std::size_t pos = from;
+  while (found == ByteVector::kNotFound && pos + needle_size <= size) {
+    std::size_t length = std::min(std::max(block_size, needle_size), 
+                                  size - pos);
+    Internal::ForEachBlock(haystack + pos, length, 
+                           [&](const std::uint8_t* block, std::size_t) {
+      std::size_t match = FindInBlockAvx2(block, length - needle_size + 1, 
+                                          raw_needle, needle_size);
+      if (match != ByteVector::kNotFound) {
+        found = pos + match;
+      }
+    });
+    pos += length - needle_size + 1;
+    block_size = std::min(2 * block_size, Internal::kCopyBlockSize);
+  }
+  return found;
+}
+
+const bool kHasAvx2 = __builtin_cpu_supports("avx2");
+#endif
+
+// Searches a long needle with the Boyer-Moore-Horspool algorithm, which 
+// skips ahead by the distance from the last occurrence of the byte under
+// the end of the window to the end of the needle.
+std::size_t FindLong(const Byte* haystack, std::size_t size, 
+                     const Byte* needle, std::size_t needle_size,
+                     std::size_t from) {
+  std::array<std::size_t, 256> shift;
+  shift.fill(needle_size);
+  for (std::size_t index = 0; index + 1 < needle_size; index++) {
+    shift[needle[index].ToInt()] = needle_size - 1 - index;
+  }
+  const Byte& last = needle[needle_size-1];
+  std::size_t pos = from;
+  while (pos + needle_size <= size) {
+    const Byte& window_last = haystack[pos+needle_size-1];
+    if (window_last == last && Equal(haystack + pos, needle, needle_size - 1)) {
+      return pos;
+    }
+    pos += shift[window_last.ToInt()];
+  }
+  return ByteVector::kNotFound;
+}
+
+std::size_t FindBytes(const Byte* haystack, std::size_t size, 
+                      const Byte* needle, std::size_t needle_size,
+                      std::size_t from) {
+  if (needle_size == 0) {
+    return from <= size ? from : ByteVector::kNotFound;
+  }
+  if (needle_size > size || from > size - needle_size) {
+    return ByteVector::kNotFound;
+  }
+  if (needle_size <= kShortNeedle) {
+#ifdef BYTE_UTILS_HAS_AVX2_SEARCH
+    if (kHasAvx2 && !Internal::PortableCodePaths()) {
+      return FindShortAvx2(haystack, size, needle, needle_size, from);
+    }
+#endif
+    return FindShort(haystack, size, needle, needle_size, from);
+  }
+  return FindLong(haystack, size, needle, needle_size, from);
+}
+
+}  // namespace
+
 ByteVector::ByteVector(const std::string& hex_string) {
   std::size_t bits_2_represent = hex_string.size() * 4;
   std::string hex_values = hex_string;
@@ -47,6 +353,12 @@ ByteVector::ByteVector(const std::string& hex_string) {
 
 ByteVector::ByteVector(const std::vector<Byte>& bytes): bytes_(bytes) {}
 
+ByteVector::ByteVector(std::vector<Byte>&& bytes): bytes_(std::move(bytes)) {}
+
+ByteVector::ByteVector(std::size_t size, const AllocationPolicy& policy) {
+  Internal::AllocateBytes(bytes_, size, policy);
+}
+
 std::ostream& operator<<(std::ostream& stream, const ByteVector& bytes) {
   for (const auto& byte : bytes) {
     stream << byte;
@@ -54,18 +366,154 @@ std::ostream& operator<<(std::ostream& stream, const ByteVector& bytes) {
   return stream;
 }
 
-Byte ByteVector::operator[](const std::size_t pos) const {
-  if (pos >= bytes_.size()) {
-    throw std::out_of_range("The position `pos` is out of range.");
+ByteVector ByteVector::operator^(const ByteVector& bytes) const & {
+  ByteVector result = *this;
+  result ^= bytes;
+  return result;
+}
+
+ByteVector ByteVector::operator^(const ByteVector& bytes) && {
+  *this ^= bytes;
+  return std::move(*this);
+}
+
+ByteVector ByteVector::operator&(const ByteVector& bytes) const & {
+  ByteVector result = *this;
+  result &= bytes;
+  return result;
+}
+
+ByteVector ByteVector::operator&(const ByteVector& bytes) && {
+  *this &= bytes;
+  return std::move(*this);
+}
+
+ByteVector ByteVector::operator|(const ByteVector& bytes) const & {
+  ByteVector result = *this;
+  result |= bytes;
+  return result;
+}
+
+ByteVector ByteVector::operator|(const ByteVector& bytes) && {
+  *this |= bytes;
+  return std::move(*this);
+}
+
+ByteVector ByteVector::operator~() const & {
+  return ~ByteVector(*this);
+}
+
+ByteVector ByteVector::operator~() && {
+  for (auto& byte : bytes_) {
+    byte = ~byte;
   }
-  return bytes_[pos];
+  return std::move(*this);
 }
 
-Byte& ByteVector::operator[](const std::size_t pos) {
-  if (pos >= bytes_.size()) {
-    throw std::out_of_range("The position `pos` is out of range.");
+ByteVector ByteVector::operator<<(std::size_t n_pos) const & {
+  ByteVector result = *this;
+  result <<= n_pos;
+  return result;
+}
+
+ByteVector ByteVector::operator<<(std::size_t n_pos) && {
+  *this <<= n_pos;
+  return std::move(*this);
+}
+
+ByteVector ByteVector::operator>>(std::size_t n_pos) const & {
+  ByteVector result = *this;
+  result >>= n_pos;
+  return result;
+}
+
+ByteVector ByteVector::operator>>(std::size_t n_pos) && {
+  *this >>= n_pos;
+  return std::move(*this);
+}
+
+ByteVector& ByteVector::operator^=(const ByteVector& bytes) {
+  if (bytes_.size() != bytes.Size()) {
+    throw std::runtime_error("Can't perform XOR operation between byte "
+                             "vectors with different sizes.");
   }
-  return bytes_[pos];
+  for (std::size_t index = 0; index < bytes_.size(); index++) {
+    bytes_[index] ^= bytes.bytes_[index];
+  }
+  return *this;
+}
+
+ByteVector& ByteVector::operator&=(const ByteVector& bytes) {
+  if (bytes_.size() != bytes.Size()) {
+    throw std::runtime_error("Can't perform AND operation between byte "
+                             "vectors with different sizes.");
+  }
+  for (std::size_t index = 0; index < bytes_.size(); index++) {
+    bytes_[index] = bytes_[index] & bytes.bytes_[index];
+  }
+  return *this;
+}
+
+ByteVector& ByteVector::operator|=(const ByteVector& bytes) {
+  if (bytes_.size() != bytes.Size()) {
+    throw std::runtime_error("Can't perform OR operation between byte "
+                             "vectors with different sizes.");
+  }
+  for (std::size_t index = 0; index < bytes_.size(); index++) {
+    bytes_[index] = bytes_[index] | bytes.bytes_[index];
+  }
+  return *this;
+}
+
+ByteVector& ByteVector::operator<<=(std::size_t n_pos) {
+  if (n_pos > bytes_.size() * 8) {
+    throw std::out_of_range("n_pos is out of range.");
+  }
+  // Moves whole bytes first, then carries the remaining bits 
+  // from the byte positioned towards the LSB.
+  const std::size_t size = bytes_.size();
+  const std::size_t n_bytes = n_pos / 8;
+  const std::size_t n_bits = n_pos % 8;
+  for (std::size_t index = 0; index < size; index++) {
+    std::size_t source = index + n_bytes;
+    unsigned int high = source < size ? bytes_[source].ToInt() : 0;
+    unsigned int low = source + 1 < size ? bytes_[source+1].ToInt() : 0;
+    bytes_[index] = static_cast<std::uint8_t>((high << n_bits) | 
+                                              (low >> (8 - n_bits)));
+  }
+  return *this;
+}
+
+ByteVector& ByteVector::operator>>=(std::size_t n_pos) {
+  if (n_pos > bytes_.size() * 8) {
+    throw std::out_of_range("n_pos is out of range.");
+  }
+  // Moves whole bytes first, then carries the remaining bits 
+  // from the byte positioned towards the MSB.
+  const std::size_t n_bytes = n_pos / 8;
+  const std::size_t n_bits = n_pos % 8;
+  for (std::size_t index = bytes_.size(); index-- > 0; ) {
+    unsigned int low = index >= n_bytes ? bytes_[index-n_bytes].ToInt() : 0;
+    unsigned int high = index >= n_bytes + 1 ? 
+                        bytes_[index-n_bytes-1].ToInt() : 0;
+    bytes_[index] = static_cast<std::uint8_t>((low >> n_bits) | 
+                                              (high << (8 - n_bits)));
+  }
+  return *this;
+}
+
+bool ByteVector::operator==(const ByteVector& bytes) const {
+  return bytes_ == bytes.bytes_;
+}
+
+bool ByteVector::operator!=(const ByteVector& bytes) const {
+  return bytes_ != bytes.bytes_;
+}
+
+bool ByteVector::operator<(const ByteVector& bytes) const {
+  return std::lexicographical_compare(bytes_.begin(), bytes_.end(),
+                                      bytes.bytes_.begin(), 
+                                      bytes.bytes_.end());
 }
 
 void ByteVector::PushBack(const Word& word) {
@@ -91,6 +539,63 @@ std::vector<Word> ByteVector::GetWord(const std::size_t pos,
   return words;
 }
 
+std::size_t ByteVector::Find(const Byte& byte, std::size_t from) const {
+  return FindBytes(bytes_.data(), bytes_.size(), &byte, 1, from);
+}
+
+std::size_t ByteVector::Find(const ByteVector& needle, 
+                             std::size_t from) const {
+  return FindBytes(bytes_.data(), bytes_.size(), needle.bytes_.data(), 
+                   needle.bytes_.size(), from);
+}
+
+std::vector<std::size_t> ByteVector::FindAll(const ByteVector& needle) const {
+  std::vector<std::size_t> positions;
+  if (needle.bytes_.empty()) {
+    return positions;
+  }
+  std::size_t pos = Find(needle);
+  while (pos != kNotFound) {
+    positions.push_back(pos);
+    pos = Find(needle, pos + 1);
+  }
+  return positions;
+}
+
+std::size_t ByteVector::Count(const Byte& byte) const {
+  return std::count(bytes_.begin(), bytes_.end(), byte);
+}
+
+std::size_t ByteVector::Count(const ByteVector& needle) const {
+  return FindAll(needle).size();
+}
+
+void ByteVector::Substitute(const std::array<Byte, 256>& table) {
+  for (auto& byte : bytes_) {
+    byte = table[byte.ToInt()];
+  }
+}
+
+void ByteVector::ReverseBits() {
+  for (auto& byte : bytes_) {
+    byte.ReverseBits();
+  }
+}
+
+void ByteVector::ReverseBytes() {
+  std::reverse(bytes_.begin(), bytes_.end());
+}
+
+ByteVector ReverseBits(ByteVector bytes) {
+  bytes.ReverseBits();
+  return bytes;
+}
+
+ByteVector ReverseBytes(ByteVector bytes) {
+  bytes.ReverseBytes();
+  return bytes;
+}
+
 std::string ByteVector::ToHex() const {
   std::stringstream stream;
   for (const auto& byte : bytes_) {
@@ -99,4 +604,115 @@ std::string ByteVector::ToHex() const {
   return stream.str();
 }
 
+std::string ByteVector::ToBase64(Base64Alphabet alphabet, 
+                                 bool padding) const {
+  const char* symbols = alphabet == Base64Alphabet::kStandard ? 
+                        kBase64Standard : kBase64UrlSafe;
+  const std::size_t size = bytes_.size();
+  const std::size_t remaining = size % 3;
+  std::string base64(size / 3 * 4 + (remaining == 0 ? 0 : 
+                                     padding ? 4 : remaining + 1), '=');
+  char* out = &base64[0];
+  // Encodes each group of 3 bytes as 4 characters, one copied block at 
+  // a time; the bytes of a group split between two blocks are carried.
+  std::uint8_t carry[3];
+  std::size_t carried = 0;
+  Internal::ForEachBlock(bytes_.data(), size, 
+                         [&](const std::uint8_t* block, std::size_t length) {
+    if (carried > 0) {
+      while (carried < 3 && length > 0) {
+        carry[carried++] = *block++;
+        --length;
+      }
+      if (carried < 3) {
+        return;
+      }
+      out += EncodeBase64Groups(carry, 3, symbols, out) / 3 * 4;
+      carried = 0;
+    }
+    std::size_t encoded = EncodeBase64Groups(block, length, symbols, out);
+    out += encoded / 3 * 4;
+    while (encoded < length) {
+      carry[carried++] = block[encoded++];
+    }
+  });
+  // Encodes the remaining 1 or 2 bytes; the padding is already in place.
+  if (remaining > 0) {
+    std::uint32_t group = carry[0] << 16;
+    if (remaining == 2) {
+      group |= carry[1] << 8;
+    }
+    *out++ = symbols[(group >> 18) & 0x3f];
+    *out++ = symbols[(group >> 12) & 0x3f];
+    if (remaining == 2) {
+      *out++ = symbols[(group >> 6) & 0x3f];
+    }
+  }
+  return base64;
+}
+
+ByteVector ByteVector::FromBase64(const std::string& base64, 
+                                  Base64Alphabet alphabet) {
+  const std::array<std::uint8_t, 256>& table = 
+      alphabet == Base64Alphabet::kStandard ? kBase64StandardDecode : 
+                                              kBase64UrlSafeDecode;
+  // Strips the padding, which is valid only if it completes 
+  // the last group of 4 characters.
+  std::size_t size = base64.size();
+  std::size_t padding = 0;
+  while (padding < 2 && size > 0 && base64[size-1] == '=') {
+    --size;
+    ++padding;
+  }
+  if (padding > 0 && base64.size() % 4 != 0) {
+    throw std::invalid_argument("Invalid Base64 padding.");
+  }
+  if (size % 4 == 1) {
+    throw std::invalid_argument("Invalid Base64 length.");
+  }
+  std::vector<Byte> bytes;
+  bytes.reserve(size / 4 * 3 + 2);
+  std::size_t index = 0;
+#ifdef BYTE_UTILS_HAS_SSSE3_BASE64
+  if (kHasSsse3 && !Internal::PortableCodePaths()) {
+    const char* symbols = alphabet == Base64Alphabet::kStandard ? 
+                          kBase64Standard : kBase64UrlSafe;
+    index = DecodeBase64Ssse3(base64.data(), size, symbols, bytes);
+  }
+#endif
+  // Decodes the characters left by the SSSE3 path, which also finds 
+  // the position of an invalid character.
+  std::uint32_t group = 0;
+  std::size_t n_chars = 0;
+  for (; index < size; index++) {
+    std::uint8_t value = table[static_cast<unsigned char>(base64[index])];
+    if (value == kBase64Invalid) {
+      throw std::invalid_argument("Invalid Base64 character at position " + 
+                                  std::to_string(index) + ".");
+    }
+    group = (group << 6) | value;
+    if (++n_chars == 4) {
+      bytes.emplace_back(static_cast<std::uint8_t>(group >> 16));
+      bytes.emplace_back(static_cast<std::uint8_t>(group >> 8));
+      bytes.emplace_back(static_cast<std::uint8_t>(group));
+      group = 0;
+      n_chars = 0;
+    }
+  }
+  // Decodes the last incomplete group; its unused bits must be `0`.
+  if (n_chars == 2) {
+    if (group & 0x0f) {
+      throw std::invalid_argument("Invalid Base64 trailing bits.");
+    }
+    bytes.emplace_back(static_cast<std::uint8_t>(group >> 4));
+  } else if (n_chars == 3) {
+    if (group & 0x03) {
+      throw std::invalid_argument("Invalid Base64 trailing bits.");
+    }
+    bytes.emplace_back(static_cast<std::uint8_t>(group >> 10));
+    bytes.emplace_back(static_cast<std::uint8_t>(group >> 2));
+  }
+  return ByteVector(std::move(bytes));
+}
+
 }  // namespace ByteUtils
\ No newline at end of file
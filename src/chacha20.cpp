@@ -0,0 +1,175 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "chacha20.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__x86_64__) && defined(__GNUC__) && defined(__has_attribute)
+#if __has_attribute(target_clones)
+// Builds the block function for AVX-512, AVX2 and baseline x86-64, 
+// selecting the version that the CPU supports when the library is loaded.
+#define BYTE_UTILS_TARGET_CLONES \
+    __attribute__((target_clones("avx512f", "avx2", "default")))
+#endif
+#endif
+#ifndef BYTE_UTILS_TARGET_CLONES
+#define BYTE_UTILS_TARGET_CLONES
+#endif
+
+namespace ByteUtils {
+
+namespace {
+
+constexpr std::uint64_t kMaxBlocks = std::uint64_t(1) << 32;
+
+// Returns the bytes of the `Word` object as little-endian 32-bit words.
+std::vector<std::uint32_t> ToLittleEndian(const Word& word) {
+  std::vector<std::uint8_t> bytes;
+  for (const auto& byte : word) {
+    bytes.push_back(byte.ToInt());
+  }
+  std::vector<std::uint32_t> words(bytes.size() / 4);
+  for (std::size_t index = 0; index < words.size(); index++) {
+    words[index] = bytes[index*4] | (bytes[index*4+1] << 8) | 
+                   (bytes[index*4+2] << 16) | 
+                   (static_cast<std::uint32_t>(bytes[index*4+3]) << 24);
+  }
+  return words;
+}
+
+inline std::uint32_t Rotl(std::uint32_t x, int n) {
+  return (x << n) | (x >> (32 - n));
+}
+
+// Applies the quarter round on the words `a`, `b`, `c` and `d` 
+// of every lane.
+#define BYTE_UTILS_QUARTER_ROUND(x, a, b, c, d)                       \
+  for (std::size_t lane = 0; lane < ChaCha20::kLanes; lane++) {       \
+    x[a][lane] += x[b][lane]; x[d][lane] = Rotl(x[d][lane] ^ x[a][lane], 16); \
+    x[c][lane] += x[d][lane]; x[b][lane] = Rotl(x[b][lane] ^ x[c][lane], 12); \
+    x[a][lane] += x[b][lane]; x[d][lane] = Rotl(x[d][lane] ^ x[a][lane], 8);  \
+    x[c][lane] += x[d][lane]; x[b][lane] = Rotl(x[b][lane] ^ x[c][lane], 7);  \
+  }
+
+// Computes `kLanes` consecutive blocks, keeping word `i` of every block 
+// in `x[i]` so each step of the rounds works on all the lanes at once.
+BYTE_UTILS_TARGET_CLONES
+void Blocks(const std::uint32_t* input, std::uint32_t counter, 
+            std::uint8_t* output) {
+  std::uint32_t x[16][ChaCha20::kLanes];
+  std::uint32_t initial[16][ChaCha20::kLanes];
+  for (std::size_t word = 0; word < 16; word++) {
+    for (std::size_t lane = 0; lane < ChaCha20::kLanes; lane++) {
+      initial[word][lane] = input[word];
+    }
+  }
+  for (std::size_t lane = 0; lane < ChaCha20::kLanes; lane++) {
+    initial[12][lane] = counter + static_cast<std::uint32_t>(lane);
+  }
+  std::copy(&initial[0][0], &initial[0][0] + 16 * ChaCha20::kLanes, &x[0][0]);
+  for (int round = 0; round < 10; round++) {
+    BYTE_UTILS_QUARTER_ROUND(x, 0, 4, 8, 12)
+    BYTE_UTILS_QUARTER_ROUND(x, 1, 5, 9, 13)
+    BYTE_UTILS_QUARTER_ROUND(x, 2, 6, 10, 14)
+    BYTE_UTILS_QUARTER_ROUND(x, 3, 7, 11, 15)
+    BYTE_UTILS_QUARTER_ROUND(x, 0, 5, 10, 15)
+    BYTE_UTILS_QUARTER_ROUND(x, 1, 6, 11, 12)
+    BYTE_UTILS_QUARTER_ROUND(x, 2, 7, 8, 13)
+    BYTE_UTILS_QUARTER_ROUND(x, 3, 4, 9, 14)
+  }
+  for (std::size_t lane = 0; lane < ChaCha20::kLanes; lane++) {
+    std::uint8_t* block = output + lane * ChaCha20::kBlockSize;
+    for (std::size_t word = 0; word < 16; word++) {
+      std::uint32_t value = x[word][lane] + initial[word][lane];
+      block[word*4] = static_cast<std::uint8_t>(value);
+      block[word*4+1] = static_cast<std::uint8_t>(value >> 8);
+      block[word*4+2] = static_cast<std::uint8_t>(value >> 16);
+      block[word*4+3] = static_cast<std::uint8_t>(value >> 24);
+    }
+  }
+}
+
+#undef BYTE_UTILS_QUARTER_ROUND
+
+}  // namespace
+
+ChaCha20::ChaCha20(const Word& key, const Word& nonce, std::uint32_t counter)
+    : counter_(counter), position_(0), available_(0) {
+  if (key.Size() != 32) {
+    throw std::invalid_argument("The ChaCha20 key must have 256 bits.");
+  }
+  if (nonce.Size() != 12) {
+    throw std::invalid_argument("The ChaCha20 nonce must have 96 bits.");
+  }
+  // The constant "expand 32-byte k", followed by the key, 
+  // the block counter and the nonce.
+  input_ = {0x61707865, 0x3320646e, 0x79622d32, 0x6b206574};
+  std::vector<std::uint32_t> key_words = ToLittleEndian(key);
+  std::vector<std::uint32_t> nonce_words = ToLittleEndian(nonce);
+  std::copy(key_words.begin(), key_words.end(), input_.begin() + 4);
+  std::copy(nonce_words.begin(), nonce_words.end(), input_.begin() + 13);
+}
+
+void ChaCha20::Apply(ByteVector& bytes) {
+  for (auto& byte : bytes) {
+    if (position_ == available_) {
+      Refill();
+    }
+    byte ^= keystream_[position_++];
+  }
+}
+
+void ChaCha20::Apply(std::uint8_t* data, std::size_t size) {
+  while (size > 0) {
+    if (position_ == available_) {
+      Refill();
+    }
+    std::size_t count = std::min(size, available_ - position_);
+    for (std::size_t index = 0; index < count; index++) {
+      data[index] ^= keystream_[position_ + index];
+    }
+    position_ += count;
+    data += count;
+    size -= count;
+  }
+}
+
+ByteVector ChaCha20::Keystream(std::size_t size) {
+  std::vector<std::uint8_t> bytes(size, 0);
+  Apply(bytes.data(), size);
+  return ByteVector(std::vector<Byte>(bytes.begin(), bytes.end()));
+}
+
+void ChaCha20::Refill() {
+  if (counter_ >= kMaxBlocks) {
+    throw std::runtime_error("The ChaCha20 block counter is exhausted.");
+  }
+  Blocks(input_.data(), static_cast<std::uint32_t>(counter_), 
+         keystream_.data());
+  // The lanes past the last counter value would repeat the keystream.
+  std::uint64_t n_blocks = std::min<std::uint64_t>(kLanes, 
+                                                   kMaxBlocks - counter_);
+  counter_ += n_blocks;
+  position_ = 0;
+  available_ = n_blocks * kBlockSize;
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
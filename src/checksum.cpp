@@ -0,0 +1,159 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "checksum.h"
+
+#include <array>
+#include <cstring>
+
+#include "byte_blocks.h"
+#include "cpu_features.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <nmmintrin.h>
+#define BYTE_UTILS_HAS_SSE42_CRC 1
+#endif
+
+namespace ByteUtils {
+
+namespace {
+
+using CrcTables = std::array<std::array<std::uint32_t, 256>, 8>;
+
+// Builds the tables for the slicing-by-8 algorithm, where the table `k` 
+// gives the contribution of a byte followed by `k` zero bytes.
+constexpr CrcTables MakeCrcTables(std::uint32_t polynomial) {
+  CrcTables tables{};
+  for (std::uint32_t value = 0; value < 256; value++) {
+    std::uint32_t crc = value;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc >> 1) ^ ((crc & 1) ? polynomial : 0);
+    }
+    tables[0][value] = crc;
+  }
+  for (std::size_t table = 1; table < 8; table++) {
+    for (std::size_t value = 0; value < 256; value++) {
+      std::uint32_t previous = tables[table-1][value];
+      tables[table][value] = (previous >> 8) ^ tables[0][previous & 0xff];
+    }
+  }
+  return tables;
+}
+
+constexpr CrcTables kCrc32Tables = MakeCrcTables(0xedb88320);
+constexpr CrcTables kCrc32cTables = MakeCrcTables(0x82f63b78);
+
+std::uint32_t UpdateTable(const CrcTables& tables, std::uint32_t crc, 
+                          const std::uint8_t* data, std::size_t size) {
+  // Processes 8 bytes per iteration with one lookup per byte.
+  while (size >= 8) {
+    std::uint32_t low = crc ^ (data[0] | (data[1] << 8) | 
+                               (data[2] << 16) | 
+                               (static_cast<std::uint32_t>(data[3]) << 24));
+    crc = tables[7][low & 0xff] ^ tables[6][(low >> 8) & 0xff] ^
+          tables[5][(low >> 16) & 0xff] ^ tables[4][low >> 24] ^
+          tables[3][data[4]] ^ tables[2][data[5]] ^
+          tables[1][data[6]] ^ tables[0][data[7]];
+    data += 8;
+    size -= 8;
+  }
+  while (size--) {
+    crc = (crc >> 8) ^ tables[0][(crc ^ *data++) & 0xff];
+  }
+  return crc;
+}
+
+#ifdef BYTE_UTILS_HAS_SSE42_CRC
+__attribute__((target("sse4.2")))
+std::uint32_t UpdateSse42(std::uint32_t crc, const std::uint8_t* data, 
+                          std::size_t size) {
+  std::uint64_t crc64 = crc;
+  while (size >= 8) {
+    std::uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+    crc64 = _mm_crc32_u64(crc64, value);
+    data += 8;
+    size -= 8;
+  }
+  crc = static_cast<std::uint32_t>(crc64);
+  while (size--) {
+    crc = _mm_crc32_u8(crc, *data++);
+  }
+  return crc;
+}
+
+const bool kHasSse42 = __builtin_cpu_supports("sse4.2");
+#endif
+
+std::uint32_t UpdateCrc32c(std::uint32_t crc, const std::uint8_t* data,
+                           std::size_t size) {
+#ifdef BYTE_UTILS_HAS_SSE42_CRC
+  if (kHasSse42 && !Internal::PortableCodePaths()) {
+    return UpdateSse42(crc, data, size);
+  }
+#endif
+  return UpdateTable(kCrc32cTables, crc, data, size);
+}
+
+}  // namespace
+
+std::uint32_t Crc32::Compute(const ByteVector& bytes) {
+  Crc32 crc;
+  crc.Update(bytes);
+  return crc.Value();
+}
+
+void Crc32::Update(const ByteVector& bytes) {
+  Internal::ForEachBlock(bytes, [this](const std::uint8_t* data, 
+                                       std::size_t size) {
+    Update(data, size);
+  });
+}
+
+void Crc32::Update(const Byte& byte) {
+  std::uint8_t data = byte.ToInt();
+  Update(&data, 1);
+}
+
+void Crc32::Update(const std::uint8_t* data, std::size_t size) {
+  state_ = UpdateTable(kCrc32Tables, state_, data, size);
+}
+
+std::uint32_t Crc32c::Compute(const ByteVector& bytes) {
+  Crc32c crc;
+  crc.Update(bytes);
+  return crc.Value();
+}
+
+void Crc32c::Update(const ByteVector& bytes) {
+  Internal::ForEachBlock(bytes, [this](const std::uint8_t* data, 
+                                       std::size_t size) {
+    Update(data, size);
+  });
+}
+
+void Crc32c::Update(const Byte& byte) {
+  std::uint8_t data = byte.ToInt();
+  Update(&data, 1);
+}
+
+void Crc32c::Update(const std::uint8_t* data, std::size_t size) {
+  state_ = UpdateCrc32c(state_, data, size);
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
@@ -0,0 +1,159 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "hash.h"
+
+#include <cstring>
+#include <utility>
+#include <vector>
+
+namespace ByteUtils {
+
+namespace {
+
+constexpr std::uint64_t kSecret[4] = {
+  0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+  0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull
+};
+
+// Number of bytes hashed from the stack before falling back to the heap.
+constexpr std::size_t kStackSize = 256;
+
+// Multiplies `a` and `b` into 128 bits and folds the halves together.
+inline std::uint64_t Mix(std::uint64_t a, std::uint64_t b) {
+#ifdef __SIZEOF_INT128__
+  __uint128_t product = static_cast<__uint128_t>(a) * b;
+  return static_cast<std::uint64_t>(product) ^ 
+         static_cast<std::uint64_t>(product >> 64);
+#else
+  std::uint64_t a_high = a >> 32, a_low = a & 0xffffffff;
+  std::uint64_t b_high = b >> 32, b_low = b & 0xffffffff;
+  std::uint64_t high_high = a_high * b_high, high_low = a_high * b_low;
+  std::uint64_t low_high = a_low * b_high, low_low = a_low * b_low;
+  std::uint64_t middle = (low_low >> 32) + (high_low & 0xffffffff) + 
+                         (low_high & 0xffffffff);
+  std::uint64_t low = (middle << 32) | (low_low & 0xffffffff);
+  std::uint64_t high = high_high + (high_low >> 32) + (low_high >> 32) + 
+                       (middle >> 32);
+  return low ^ high;
+#endif
+}
+
+inline std::uint64_t Read64(const std::uint8_t* data) {
+  std::uint64_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+inline std::uint64_t Read32(const std::uint8_t* data) {
+  std::uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return value;
+}
+
+// Reads 1 to 3 bytes spread over a 64-bit value.
+inline std::uint64_t ReadSmall(const std::uint8_t* data, std::size_t size) {
+  return (static_cast<std::uint64_t>(data[0]) << 16) | 
+         (static_cast<std::uint64_t>(data[size >> 1]) << 8) | 
+         data[size - 1];
+}
+
+// Copies the bytes of a `Byte` range into contiguous memory and hashes 
+// them; short inputs don't touch the heap.
+template <typename Iterator>
+std::uint64_t HashRange(Iterator begin, Iterator end, std::size_t size,
+                        std::uint64_t seed) {
+  std::uint8_t stack[kStackSize];
+  std::vector<std::uint8_t> heap;
+  std::uint8_t* data = stack;
+  if (size > kStackSize) {
+    heap.resize(size);
+    data = heap.data();
+  }
+  std::size_t index = 0;
+  for (auto it = begin; it != end; ++it) {
+    data[index++] = it->ToInt();
+  }
+  return Hash64(data, size, seed);
+}
+
+}  // namespace
+
+std::uint64_t Hash64(const std::uint8_t* data, std::size_t size, 
+                     std::uint64_t seed) {
+  seed ^= Mix(seed ^ kSecret[0], kSecret[1]);
+  std::uint64_t a = 0;
+  std::uint64_t b = 0;
+  if (size <= 16) {
+    if (size >= 4) {
+      a = (Read32(data) << 32) | Read32(data + ((size >> 3) << 2));
+      b = (Read32(data + size - 4) << 32) | 
+          Read32(data + size - 4 - ((size >> 3) << 2));
+    } else if (size > 0) {
+      a = ReadSmall(data, size);
+    }
+  } else {
+    std::size_t remaining = size;
+    const std::uint8_t* position = data;
+    // Runs three independent lanes over 48-byte blocks.
+    if (remaining > 48) {
+      std::uint64_t lane1 = seed;
+      std::uint64_t lane2 = seed;
+      do {
+        seed = Mix(Read64(position) ^ kSecret[1], 
+                   Read64(position + 8) ^ seed);
+        lane1 = Mix(Read64(position + 16) ^ kSecret[2], 
+                    Read64(position + 24) ^ lane1);
+        lane2 = Mix(Read64(position + 32) ^ kSecret[3], 
+                    Read64(position + 40) ^ lane2);
+        position += 48;
+        remaining -= 48;
+      } while (remaining > 48);
+      seed ^= lane1 ^ lane2;
+    }
+    while (remaining > 16) {
+      seed = Mix(Read64(position) ^ kSecret[1], Read64(position + 8) ^ seed);
+      position += 16;
+      remaining -= 16;
+    }
+    // The last 16 bytes overlap the previous block when needed.
+    a = Read64(position + remaining - 16);
+    b = Read64(position + remaining - 8);
+  }
+  a ^= kSecret[1];
+  b ^= seed;
+  std::uint64_t product_low = a * b;
+  std::uint64_t product_mix = Mix(a, b);
+  return Mix(product_low ^ kSecret[0] ^ size, product_mix ^ kSecret[1]);
+}
+
+std::uint64_t Hash64(const ByteVector& bytes, std::uint64_t seed) {
+  return HashRange(bytes.begin(), bytes.end(), bytes.Size(), seed);
+}
+
+std::uint64_t Hash64(const Word& word, std::uint64_t seed) {
+  return HashRange(word.begin(), word.end(), word.Size(), seed);
+}
+
+HashedByteVector::HashedByteVector(const ByteVector& bytes)
+    : bytes_(bytes), hash_(Hash64(bytes_)) {}
+
+HashedByteVector::HashedByteVector(ByteVector&& bytes)
+    : bytes_(std::move(bytes)), hash_(Hash64(bytes_)) {}
+
+}  // namespace ByteUtils
\ No newline at end of file
@@ -0,0 +1,218 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "hex_batch.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace ByteUtils {
+
+namespace {
+
+// The smallest number of lines worth handing to a separate thread.
+constexpr std::size_t kMinLinesPerThread = 4096;
+
+// Builds the table that maps a hexadecimal digit to its value and any 
+// other character to `-1`.
+constexpr std::array<std::int8_t, 256> MakeDigitTable() {
+  std::array<std::int8_t, 256> table{};
+  for (std::size_t c = 0; c < 256; c++) {
+    table[c] = -1;
+  }
+  for (std::size_t c = '0'; c <= '9'; c++) {
+    table[c] = c - '0';
+  }
+  for (std::size_t c = 'a'; c <= 'f'; c++) {
+    table[c] = c - 'a' + 10;
+    table[c - 'a' + 'A'] = c - 'a' + 10;
+  }
+  return table;
+}
+
+constexpr std::array<std::int8_t, 256> kDigits = MakeDigitTable();
+
+// Returns the position of the first character of `line` that isn't 
+// a hexadecimal digit, or `size` if there is none.
+std::size_t FindInvalid(const char* line, std::size_t size) {
+  for (std::size_t i = 0; i < size; i++) {
+    if (kDigits[static_cast<std::uint8_t>(line[i])] < 0) {
+      return i;
+    }
+  }
+  return size;
+}
+
+// Decodes the `size` valid digits of `line` into `out`.
+void Decode(const char* line, std::size_t size, Byte* out) {
+  std::size_t i = 0;
+  if (size % 2 != 0) {
+    *out++ = static_cast<std::uint8_t>(kDigits[
+        static_cast<std::uint8_t>(line[i++])]);
+  }
+  for (; i < size; i += 2) {
+    *out++ = static_cast<std::uint8_t>(
+        (kDigits[static_cast<std::uint8_t>(line[i])] << 4) | 
+        kDigits[static_cast<std::uint8_t>(line[i + 1])]);
+  }
+}
+
+// Calls `function(first, last, worker)` for consecutive ranges of the 
+// `count` lines, each on its own thread. The first exception thrown by 
+// `function` or by starting a thread is rethrown once every started 
+// thread is joined.
+template <typename Function>
+void ForEachRange(std::size_t count, std::size_t threads, 
+                  Function function) {
+  std::vector<std::exception_ptr> errors(threads);
+  auto run = [&function, &errors](std::size_t first, std::size_t last, 
+                                  std::size_t worker) {
+    try {
+      function(first, last, worker);
+    } catch (...) {
+      errors[worker] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers;
+  const std::size_t per_thread = (count + threads - 1) / threads;
+  try {
+    for (std::size_t worker = 0; worker < threads; worker++) {
+      std::size_t first = std::min(count, worker * per_thread);
+      std::size_t last = std::min(count, first + per_thread);
+      if (worker + 1 == threads) {
+        // The calling thread handles the last range.
+        run(first, last, worker);
+      } else {
+        workers.emplace_back(run, first, last, worker);
+      }
+    }
+  } catch (...) {
+    for (auto& thread : workers) {
+      thread.join();
+    }
+    throw;
+  }
+  for (auto& thread : workers) {
+    thread.join();
+  }
+  for (const auto& error : errors) {
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+}
+
+}  // namespace
+
+HexBatch HexBatch::Parse(const std::string& text, std::size_t threads) {
+  std::vector<const char*> lines;
+  std::vector<std::size_t> sizes;
+  const char* data = text.data();
+  const char* end = data + text.size();
+  while (data < end) {
+    const char* newline = static_cast<const char*>(
+        std::memchr(data, '\n', end - data));
+    const char* line_end = newline ? newline : end;
+    std::size_t size = line_end - data;
+    if (size > 0 && data[size - 1] == '\r') {
+      size--;
+    }
+    lines.push_back(data);
+    sizes.push_back(size);
+    data = line_end + 1;
+  }
+  return Parse(lines, sizes, threads);
+}
+
+HexBatch HexBatch::Parse(const std::vector<std::string>& lines, 
+                         std::size_t threads) {
+  std::vector<const char*> data;
+  std::vector<std::size_t> sizes;
+  data.reserve(lines.size());
+  sizes.reserve(lines.size());
+  for (const auto& line : lines) {
+    data.push_back(line.data());
+    sizes.push_back(line.size());
+  }
+  return Parse(data, sizes, threads);
+}
+
+HexBatch HexBatch::Parse(const std::vector<const char*>& lines, 
+                         const std::vector<std::size_t>& sizes, 
+                         std::size_t threads) {
+  const std::size_t count = lines.size();
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  threads = std::max<std::size_t>(1, std::min(threads, 
+                                              count / kMinLinesPerThread));
+  HexBatch batch;
+  batch.offsets_.assign(count + 1, 0);
+  std::vector<std::vector<HexParseError>> errors(threads);
+  // Validates the lines and stores the length of each one, so that 
+  // the prefix sums give the position of every line in the arena.
+  ForEachRange(count, threads, [&](std::size_t first, std::size_t last, 
+                                   std::size_t worker) {
+    for (std::size_t line = first; line < last; line++) {
+      std::size_t invalid = FindInvalid(lines[line], sizes[line]);
+      if (invalid != sizes[line]) {
+        errors[worker].push_back({line, 
+            "Invalid hexadecimal character '" + 
+            std::string(1, lines[line][invalid]) + "' at column " + 
+            std::to_string(invalid) + "."});
+        continue;
+      }
+      batch.offsets_[line + 1] = (sizes[line] + 1) / 2;
+    }
+  });
+  for (std::size_t line = 0; line < count; line++) {
+    batch.offsets_[line + 1] += batch.offsets_[line];
+  }
+  std::vector<Byte> arena(batch.offsets_[count]);
+  ForEachRange(count, threads, [&](std::size_t first, std::size_t last, 
+                                   std::size_t) {
+    for (std::size_t line = first; line < last; line++) {
+      if (batch.offsets_[line + 1] != batch.offsets_[line]) {
+        Decode(lines[line], sizes[line], arena.data() + batch.offsets_[line]);
+      }
+    }
+  });
+  batch.arena_ = SharedByteVector(ByteVector(std::move(arena)));
+  for (auto& worker_errors : errors) {
+    batch.errors_.insert(batch.errors_.end(), 
+                         std::make_move_iterator(worker_errors.begin()), 
+                         std::make_move_iterator(worker_errors.end()));
+  }
+  return batch;
+}
+
+SharedByteVector HexBatch::operator[](std::size_t line) const {
+  if (line >= Size()) {
+    throw std::out_of_range("The line " + std::to_string(line) + 
+                            " is out of range.");
+  }
+  return arena_.Slice(offsets_[line], offsets_[line + 1] - offsets_[line]);
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
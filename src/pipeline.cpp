@@ -0,0 +1,178 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "pipeline.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace ByteUtils {
+
+namespace {
+
+// A bounded queue of chunks between two threads of a pipeline.
+class ChunkQueue {
+  public:
+    explicit ChunkQueue(std::size_t capacity): capacity_(capacity) {}
+    // Waits for free space and appends `chunk`. Returns `false` if the 
+    // pipeline was cancelled.
+    bool Push(ByteVector&& chunk) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_full_.wait(lock, [this] { 
+        return cancelled_ || chunks_.size() < capacity_; 
+      });
+      if (cancelled_) {
+        return false;
+      }
+      chunks_.push_back(std::move(chunk));
+      not_empty_.notify_one();
+      return true;
+    }
+    // Waits for a chunk and moves it into `chunk`. Returns `false` once 
+    // the queue is closed and drained, or if the pipeline was cancelled.
+    bool Pop(ByteVector& chunk) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      not_empty_.wait(lock, [this] { 
+        return cancelled_ || closed_ || !chunks_.empty(); 
+      });
+      if (cancelled_ || chunks_.empty()) {
+        return false;
+      }
+      chunk = std::move(chunks_.front());
+      chunks_.pop_front();
+      not_full_.notify_one();
+      return true;
+    }
+    // Marks that no more chunks will be pushed.
+    void Close() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      closed_ = true;
+      not_empty_.notify_all();
+    }
+    // Wakes up and stops both ends of the queue.
+    void Cancel() {
+      std::lock_guard<std::mutex> lock(mutex_);
+      cancelled_ = true;
+      not_empty_.notify_all();
+      not_full_.notify_all();
+    }
+  private:
+    std::size_t capacity_;
+    std::deque<ByteVector> chunks_;
+    bool closed_ = false;
+    bool cancelled_ = false;
+    std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::condition_variable not_full_;
+};
+
+}  // namespace
+
+Pipeline::Pipeline(Source source, std::size_t queue_capacity)
+    : source_(std::move(source)), queue_capacity_(queue_capacity) {
+  if (queue_capacity_ == 0) {
+    throw std::invalid_argument("The queue capacity must be at least 1.");
+  }
+}
+
+Pipeline& Pipeline::Then(Transform transform, bool own_thread) {
+  stages_.push_back({std::move(transform), own_thread});
+  return *this;
+}
+
+void Pipeline::Run(const Sink& sink) {
+  // Splits the stages into segments that start at each stage with its 
+  // own thread; consecutive segments are connected through a queue.
+  std::vector<std::size_t> starts = {0};
+  for (std::size_t stage = 0; stage < stages_.size(); stage++) {
+    if (stages_[stage].own_thread) {
+      starts.push_back(stage);
+    }
+  }
+  starts.push_back(stages_.size());
+  const std::size_t segments = starts.size() - 1;
+  std::vector<std::unique_ptr<ChunkQueue>> queues;
+  for (std::size_t i = 1; i < segments; i++) {
+    queues.push_back(std::make_unique<ChunkQueue>(queue_capacity_));
+  }
+  std::mutex error_mutex;
+  std::exception_ptr error;
+  // Pulls the chunks of the segment `segment` from the source or from 
+  // the previous queue, and passes them to the next queue or to `sink`.
+  auto run_segment = [&](std::size_t segment) {
+    try {
+      ByteVector chunk;
+      while (segment == 0 ? source_(chunk) : queues[segment - 1]->Pop(chunk)) {
+        for (std::size_t stage = starts[segment]; 
+             stage < starts[segment + 1]; stage++) {
+          stages_[stage].transform(chunk);
+        }
+        if (segment + 1 == segments) {
+          sink(chunk);
+        } else if (!queues[segment]->Push(std::move(chunk))) {
+          break;
+        }
+        chunk = ByteVector();
+      }
+      if (segment + 1 < segments) {
+        queues[segment]->Close();
+      }
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+      }
+      for (auto& queue : queues) {
+        queue->Cancel();
+      }
+    }
+  };
+  std::vector<std::thread> threads;
+  try {
+    for (std::size_t segment = 0; segment + 1 < segments; segment++) {
+      threads.emplace_back(run_segment, segment);
+    }
+  } catch (...) {
+    // Stops the segments that already started before the error leaves 
+    // their threads joinable.
+    for (auto& queue : queues) {
+      queue->Cancel();
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    throw;
+  }
+  run_segment(segments - 1);
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
@@ -0,0 +1,236 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "radix_sort.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <thread>
+#include <utility>
+
+namespace ByteUtils {
+
+namespace {
+
+// Ranges smaller than this are sorted by comparison.
+constexpr std::size_t kComparisonThreshold = 32;
+// The smallest number of keys worth sorting on several threads.
+constexpr std::size_t kMinParallelKeys = 1 << 16;
+// The number of tasks per thread that the keys are split into, so that
+// the threads stay busy even when the tasks have uneven costs.
+constexpr std::size_t kTasksPerThread = 8;
+// Keys that end before the current byte go to the bucket `0`, 
+// before the buckets of the 256 byte values.
+constexpr std::size_t kBuckets = 257;
+
+using Key = const ByteVector*;
+
+// Returns the bucket of `key` for the byte at `depth`.
+inline std::size_t Bucket(Key key, std::size_t depth) {
+  return depth < key->Size() ? key->Data()[depth].ToInt() + 1 : 0;
+}
+
+// Sorts the keys that share their first `depth` bytes by comparison.
+void ComparisonSort(Key* first, Key* last, std::size_t depth) {
+  std::sort(first, last, [depth](Key a, Key b) {
+    return std::lexicographical_compare(a->Data() + depth, 
+                                        a->Data() + a->Size(), 
+                                        b->Data() + depth, 
+                                        b->Data() + b->Size());
+  });
+}
+
+// Distributes the keys by their byte at `depth` through `buffer` and
+// returns the start of every bucket, followed by the end of the range.
+std::array<std::size_t, kBuckets + 1> Distribute(Key* first, Key* last, 
+                                                 Key* buffer, 
+                                                 std::size_t depth) {
+  std::array<std::size_t, kBuckets + 1> starts{};
+  for (Key* key = first; key != last; ++key) {
+    starts[Bucket(*key, depth) + 1]++;
+  }
+  for (std::size_t bucket = 1; bucket <= kBuckets; bucket++) {
+    starts[bucket] += starts[bucket - 1];
+  }
+  std::array<std::size_t, kBuckets> positions;
+  std::copy(starts.begin(), starts.begin() + kBuckets, positions.begin());
+  for (Key* key = first; key != last; ++key) {
+    buffer[positions[Bucket(*key, depth)]++] = *key;
+  }
+  std::copy(buffer, buffer + (last - first), first);
+  return starts;
+}
+
+// Sorts the keys that share their first `depth` bytes, using `buffer`
+// of the same size as scratch space.
+void Sort(Key* first, Key* last, Key* buffer, std::size_t depth) {
+  while (static_cast<std::size_t>(last - first) >= kComparisonThreshold) {
+    auto starts = Distribute(first, last, buffer, depth);
+    // The keys that ended are equal, so only the other buckets are sorted;
+    // the largest one is handled by the loop to bound the recursion.
+    std::size_t largest = 1;
+    for (std::size_t bucket = 1; bucket < kBuckets; bucket++) {
+      if (starts[bucket + 1] - starts[bucket] > 
+          starts[largest + 1] - starts[largest]) {
+        largest = bucket;
+      }
+    }
+    for (std::size_t bucket = 1; bucket < kBuckets; bucket++) {
+      if (bucket != largest && starts[bucket + 1] - starts[bucket] > 1) {
+        Sort(first + starts[bucket], first + starts[bucket + 1], 
+             buffer + starts[bucket], depth + 1);
+      }
+    }
+    buffer += starts[largest];
+    last = first + starts[largest + 1];
+    first += starts[largest];
+    depth++;
+  }
+  ComparisonSort(first, last, depth);
+}
+
+// A range of keys that share their first `depth` bytes.
+struct Task {
+  std::size_t first;
+  std::size_t last;
+  std::size_t depth;
+};
+
+// Distributes the `size` keys by their leading bytes until every bucket 
+// has at most `max_size` keys, and returns the buckets, largest first.
+// The keys that end before a bucket is split are already in place.
+std::vector<Task> SplitTasks(Key* keys, Key* buffer, std::size_t size, 
+                             std::size_t max_size) {
+  std::vector<Task> tasks;
+  std::vector<Task> pending = {{0, size, 0}};
+  while (!pending.empty()) {
+    Task task = pending.back();
+    pending.pop_back();
+    if (task.last - task.first <= max_size) {
+      tasks.push_back(task);
+      continue;
+    }
+    auto starts = Distribute(keys + task.first, keys + task.last, 
+                             buffer + task.first, task.depth);
+    for (std::size_t bucket = 1; bucket < kBuckets; bucket++) {
+      if (starts[bucket + 1] - starts[bucket] > 1) {
+        pending.push_back({task.first + starts[bucket], 
+                           task.first + starts[bucket + 1], task.depth + 1});
+      }
+    }
+  }
+  // The large tasks are taken first, so that the small ones fill the gaps
+  // at the end.
+  std::sort(tasks.begin(), tasks.end(), [](const Task& a, const Task& b) {
+    return a.last - a.first > b.last - b.first;
+  });
+  return tasks;
+}
+
+// Returns the largest number of keys of a task for `threads` threads.
+std::size_t MaxTaskSize(std::size_t size, std::size_t threads) {
+  return std::max(kComparisonThreshold, size / (threads * kTasksPerThread));
+}
+
+// Moves the keys into the order given by `order`.
+void Permute(std::vector<ByteVector>& keys, const std::vector<Key>& order) {
+  std::vector<ByteVector> sorted;
+  sorted.reserve(keys.size());
+  for (Key key : order) {
+    sorted.push_back(std::move(*const_cast<ByteVector*>(key)));
+  }
+  keys = std::move(sorted);
+}
+
+// Returns the addresses of the keys.
+std::vector<Key> Addresses(const std::vector<ByteVector>& keys) {
+  std::vector<Key> order;
+  order.reserve(keys.size());
+  for (const auto& key : keys) {
+    order.push_back(&key);
+  }
+  return order;
+}
+
+}  // namespace
+
+void RadixSort(std::vector<ByteVector>& keys) {
+  std::vector<Key> order = Addresses(keys);
+  std::vector<Key> buffer(order.size());
+  Sort(order.data(), order.data() + order.size(), buffer.data(), 0);
+  Permute(keys, order);
+}
+
+void ParallelRadixSort(std::vector<ByteVector>& keys, std::size_t threads) {
+  if (threads == 0) {
+    threads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  if (threads == 1 || keys.size() < kMinParallelKeys) {
+    RadixSort(keys);
+    return;
+  }
+  std::vector<Key> order = Addresses(keys);
+  std::vector<Key> buffer(order.size());
+  Key* first = order.data();
+  std::vector<Task> tasks = SplitTasks(first, buffer.data(), order.size(), 
+                                       MaxTaskSize(order.size(), threads));
+  // Every thread takes the next unsorted task until none is left.
+  std::atomic<std::size_t> next_task(0);
+  auto worker = [&]() {
+    for (std::size_t index = next_task++; index < tasks.size(); 
+         index = next_task++) {
+      const Task& task = tasks[index];
+      Sort(first + task.first, first + task.last, buffer.data() + task.first,
+           task.depth);
+    }
+  };
+  std::vector<std::thread> workers;
+  try {
+    for (std::size_t i = 1; i < threads; i++) {
+      workers.emplace_back(worker);
+    }
+  } catch (...) {
+    // A thread couldn't be started; the tasks are claimed one at a time, 
+    // so the started threads and the calling one still finish them all.
+  }
+  worker();
+  for (auto& thread : workers) {
+    thread.join();
+  }
+  Permute(keys, order);
+}
+
+namespace Internal {
+
+std::vector<std::size_t> ParallelSortTasks(const std::vector<ByteVector>& keys,
+                                           std::size_t threads) {
+  std::vector<Key> order = Addresses(keys);
+  std::vector<Key> buffer(order.size());
+  std::vector<std::size_t> sizes;
+  for (const auto& task : SplitTasks(order.data(), buffer.data(), 
+                                     order.size(), 
+                                     MaxTaskSize(order.size(), threads))) {
+    sizes.push_back(task.last - task.first);
+  }
+  return sizes;
+}
+
+}  // namespace Internal
+
+}  // namespace ByteUtils
\ No newline at end of file
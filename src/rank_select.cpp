@@ -0,0 +1,217 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "rank_select.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace ByteUtils {
+
+namespace {
+
+// The number of words of a superblock.
+constexpr std::size_t kWordsPerSuper = 8;
+// The number of set bits between two select samples.
+constexpr std::size_t kSelectSample = 512;
+
+inline std::size_t PopCount(std::uint64_t word) {
+  return __builtin_popcountll(word);
+}
+
+// Returns the number of set bits before the word `word` of a superblock
+// from its packed `ranks`. For the word `0`, the shift selects the unused
+// highest bit, which is always `0`.
+inline std::size_t WordRank(std::uint64_t ranks, std::size_t word) {
+  const std::uint64_t field = word - 1;
+  return (ranks >> ((field + ((field >> 60) & 8)) * 9)) & 0x1ff;
+}
+
+// Returns the position, counted from the MSB, of the set bit with 
+// the zero-based index `k` of `word`.
+std::size_t SelectInWord(std::uint64_t word, std::size_t k) {
+  std::size_t pos = 0;
+  // Skips whole bytes first, then the bits of the byte that holds it.
+  for (std::size_t count; (count = PopCount(word >> 56)) <= k; 
+       word <<= 8, pos += 8) {
+    k -= count;
+  }
+  for (;; word <<= 1, pos++) {
+    if (word >> 63) {
+      if (k == 0) {
+        return pos;
+      }
+      k--;
+    }
+  }
+}
+
+}  // namespace
+
+RankSelectIndex::RankSelectIndex(const ByteVector& bitmap) {
+  Rebuild(bitmap);
+}
+
+void RankSelectIndex::Rebuild(const ByteVector& bitmap) {
+  size_ = bitmap.Size() * 8;
+  words_.assign((bitmap.Size() + 7) / 8, 0);
+  LoadWords(bitmap, 0, bitmap.Size());
+  const std::size_t supers = (words_.size() + kWordsPerSuper - 1) / 
+                             kWordsPerSuper;
+  block_ranks_.assign(supers, 0);
+  super_ranks_.assign(supers + 1, 0);
+  for (std::size_t super = 0; super < supers; super++) {
+    super_ranks_[super + 1] = super_ranks_[super] + CountSuperblock(super);
+  }
+  select_samples_.clear();
+  ComputeSamples(0, supers);
+}
+
+void RankSelectIndex::Update(const ByteVector& bitmap, 
+                             std::size_t first_byte, std::size_t count) {
+  if (bitmap.Size() * 8 != size_) {
+    throw std::invalid_argument("The size of the bitmap changed; the index "
+                                "must be rebuilt.");
+  }
+  if (first_byte > bitmap.Size() || count > bitmap.Size() - first_byte) {
+    throw std::out_of_range("The modified bytes are out of range.");
+  }
+  if (count == 0) {
+    return;
+  }
+  LoadWords(bitmap, first_byte, first_byte + count);
+  const std::size_t first_super = first_byte / 8 / kWordsPerSuper;
+  const std::size_t last_super = 
+      (first_byte + count - 1) / 8 / kWordsPerSuper + 1;
+  const std::uint64_t old_rank = super_ranks_[last_super];
+  for (std::size_t super = first_super; super < last_super; super++) {
+    super_ranks_[super + 1] = super_ranks_[super] + CountSuperblock(super);
+  }
+  // The following superblocks only move by the difference in the number 
+  // of set bits, which wraps around when it is negative.
+  const std::uint64_t delta = super_ranks_[last_super] - old_rank;
+  if (delta == 0) {
+    ComputeSamples(first_super, last_super);
+    return;
+  }
+  for (std::size_t super = last_super + 1; super < super_ranks_.size(); 
+       super++) {
+    super_ranks_[super] += delta;
+  }
+  // Every sample after the modified superblocks can move.
+  select_samples_.resize((super_ranks_[first_super] + kSelectSample - 1) / 
+                         kSelectSample);
+  ComputeSamples(first_super, super_ranks_.size() - 1);
+}
+
+void RankSelectIndex::LoadWords(const ByteVector& bitmap, 
+                                std::size_t first_byte, 
+                                std::size_t last_byte) {
+  const Byte* data = bitmap.Data();
+  for (std::size_t word = first_byte / 8; word * 8 < last_byte; word++) {
+    std::uint64_t value = 0;
+    for (std::size_t byte = word * 8; byte < word * 8 + 8; byte++) {
+      value = (value << 8) | (byte < bitmap.Size() ? data[byte].ToInt() : 0);
+    }
+    words_[word] = value;
+  }
+}
+
+std::uint64_t RankSelectIndex::CountSuperblock(std::size_t super) {
+  const std::size_t first = super * kWordsPerSuper;
+  const std::size_t end = std::min(words_.size(), first + kWordsPerSuper);
+  std::uint64_t ranks = 0;
+  std::uint64_t rank = PopCount(words_[first]);
+  for (std::size_t word = first + 1; word < end; word++) {
+    ranks |= rank << ((word - first - 1) * 9);
+    rank += PopCount(words_[word]);
+  }
+  block_ranks_[super] = ranks;
+  return rank;
+}
+
+void RankSelectIndex::ComputeSamples(std::size_t first_super, 
+                                     std::size_t last_super) {
+  std::size_t sample = (super_ranks_[first_super] + kSelectSample - 1) / 
+                       kSelectSample;
+  for (std::size_t super = first_super; super < last_super; super++) {
+    for (; sample * kSelectSample < super_ranks_[super + 1]; sample++) {
+      if (sample < select_samples_.size()) {
+        select_samples_[sample] = super;
+      } else {
+        select_samples_.push_back(super);
+      }
+    }
+  }
+}
+
+std::size_t RankSelectIndex::Rank(std::size_t pos) const {
+  if (pos > size_) {
+    throw std::out_of_range("The position " + std::to_string(pos) + 
+                            " is out of range.");
+  }
+  const std::size_t word = pos / 64;
+  const std::size_t bit = pos % 64;
+  if (word == words_.size()) {
+    return Ones();
+  }
+  const std::size_t super = word / kWordsPerSuper;
+  std::size_t rank = super_ranks_[super] + 
+                     WordRank(block_ranks_[super], word % kWordsPerSuper);
+  if (bit == 0) {
+    return rank;
+  }
+  return rank + PopCount(words_[word] >> (64 - bit));
+}
+
+std::size_t RankSelectIndex::Select(std::size_t k) const {
+  if (k >= Ones()) {
+    throw std::out_of_range("There are only " + std::to_string(Ones()) + 
+                            " set bits.");
+  }
+  // The bit lies between the superblocks of its sample and of the next one.
+  const std::size_t sample = k / kSelectSample;
+  auto first = super_ranks_.begin() + select_samples_[sample];
+  auto last = sample + 1 < select_samples_.size() 
+      ? super_ranks_.begin() + select_samples_[sample + 1] + 1 
+      : super_ranks_.end() - 1;
+  const std::size_t super = 
+      std::upper_bound(first, last, k) - super_ranks_.begin() - 1;
+  const std::size_t rank = k - super_ranks_[super];
+  const std::uint64_t ranks = block_ranks_[super];
+  const std::size_t words = std::min(kWordsPerSuper, 
+                                     words_.size() - super * kWordsPerSuper);
+  std::size_t word = 0;
+  while (word + 1 < words && WordRank(ranks, word + 1) <= rank) {
+    word++;
+  }
+  return (super * kWordsPerSuper + word) * 64 + 
+         SelectInWord(words_[super * kWordsPerSuper + word], 
+                      rank - WordRank(ranks, word));
+}
+
+bool RankSelectIndex::Test(std::size_t pos) const {
+  if (pos >= size_) {
+    throw std::out_of_range("The position " + std::to_string(pos) + 
+                            " is out of range.");
+  }
+  return (words_[pos / 64] >> (63 - pos % 64)) & 1;
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
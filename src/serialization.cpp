@@ -0,0 +1,220 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "serialization.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+#include "byte_blocks.h"
+#include "checksum.h"
+#include "varint.h"
+
+namespace ByteUtils {
+
+namespace {
+
+// Returns the CRC-32C of `size` bytes starting from `data`.
+std::uint32_t Crc32cOf(const Byte* data, std::size_t size) {
+  Crc32c crc;
+  Internal::ForEachBlock(data, size, [&crc](const std::uint8_t* block, 
+                                  std::size_t length) {
+    crc.Update(block, length);
+  });
+  return crc.Value();
+}
+
+}  // namespace
+
+BinaryWriter::BinaryWriter(Checksum checksum): checksum_(checksum) {}
+
+void BinaryWriter::Write(const ByteVector& bytes) {
+  WriteRecord(bytes.Data(), bytes.Size());
+}
+
+void BinaryWriter::Write(const Word& word) {
+  WriteRecord(word.Data(), word.Size());
+}
+
+void BinaryWriter::Write(const SharedByteVector& bytes) {
+  WriteRecord(bytes.Data(), bytes.Size());
+}
+
+void BinaryWriter::Write(const std::vector<ByteVector>& collection) {
+  WriteVarint(collection.size());
+  for (const auto& bytes : collection) {
+    Write(bytes);
+  }
+}
+
+void BinaryWriter::Write(const std::vector<Word>& collection) {
+  WriteVarint(collection.size());
+  for (const auto& word : collection) {
+    Write(word);
+  }
+}
+
+void BinaryWriter::WriteRecord(const Byte* data, std::size_t size) {
+  WriteVarint(size);
+  // The checksum is updated with the same blocks that are appended, so the 
+  // record is read only once.
+  const bool with_crc = checksum_ == Checksum::kCrc32c;
+  Crc32c crc_state;
+  Internal::ForEachBlock(data, size, [this, with_crc, &crc_state](
+                             const std::uint8_t* block, std::size_t length) {
+    builder_.Append(block, length);
+    if (with_crc) {
+      crc_state.Update(block, length);
+    }
+  });
+  if (with_crc) {
+    std::uint32_t crc = crc_state.Value();
+    std::uint8_t encoded[4] = {
+      static_cast<std::uint8_t>(crc), static_cast<std::uint8_t>(crc >> 8),
+      static_cast<std::uint8_t>(crc >> 16), static_cast<std::uint8_t>(crc >> 24)
+    };
+    builder_.Append(encoded, sizeof(encoded));
+  }
+}
+
+void BinaryWriter::WriteVarint(std::uint64_t value) {
+  std::uint8_t encoded[kMaxVarint64Size];
+  builder_.Append(encoded, EncodeVarint(value, encoded));
+}
+
+BinaryReader::BinaryReader(const SharedByteVector& buffer, Checksum checksum)
+    : buffer_(buffer), checksum_(checksum) {}
+
+BinaryReader::BinaryReader(int fd, Checksum checksum, std::size_t chunk_size)
+    : source_(std::make_unique<ByteVectorReader>(fd, chunk_size)), 
+      checksum_(checksum) {}
+
+bool BinaryReader::Ensure(std::size_t size) {
+  if (buffer_.Size() - position_ >= size) {
+    return true;
+  }
+  if (!source_) {
+    return false;
+  }
+  ByteVector chunk;
+  if (position_ == buffer_.Size()) {
+    // The buffer is consumed, so the next chunk becomes the buffer 
+    // without copying.
+    if (!source_->Next(chunk)) {
+      return false;
+    }
+    buffer_ = SharedByteVector(std::move(chunk));
+    position_ = 0;
+    if (buffer_.Size() >= size) {
+      return true;
+    }
+  }
+  // A record spans several chunks, so the unread bytes are moved to a new 
+  // buffer followed by whole chunks until enough bytes are available. 
+  // The views of the old buffer stay valid.
+  std::vector<Byte> bytes(buffer_.Data() + position_, 
+                          buffer_.Data() + buffer_.Size());
+  bool exhausted = false;
+  while (bytes.size() < size) {
+    if (!source_->Next(chunk)) {
+      exhausted = true;
+      break;
+    }
+    const Byte* data = chunk.Data();
+    bytes.insert(bytes.end(), data, data + chunk.Size());
+  }
+  buffer_ = SharedByteVector(ByteVector(std::move(bytes)));
+  position_ = 0;
+  return !exhausted;
+}
+
+std::uint64_t BinaryReader::ReadVarint() {
+  std::uint64_t value = 0;
+  for (std::size_t i = 0; i < kMaxVarint64Size; i++) {
+    if (!Ensure(1)) {
+      throw std::runtime_error("The serialized data is truncated.");
+    }
+    std::uint8_t byte = buffer_.Data()[position_++].ToInt();
+    // The last byte holds only the highest bit of a 64-bit value.
+    if (i == kMaxVarint64Size - 1 && byte > 1) {
+      throw std::runtime_error("The serialized length is malformed.");
+    }
+    value |= std::uint64_t(byte & 0x7f) << (7 * i);
+    if (!(byte & 0x80)) {
+      return value;
+    }
+  }
+  throw std::runtime_error("The serialized length is malformed.");
+}
+
+bool BinaryReader::Next(SharedByteVector& record) {
+  if (!Ensure(1)) {
+    return false;
+  }
+  std::uint64_t size = ReadVarint();
+  const std::size_t checksum_size = checksum_ == Checksum::kCrc32c ? 4 : 0;
+  if (size > SIZE_MAX - checksum_size || !Ensure(size + checksum_size)) {
+    throw std::runtime_error("The serialized data is truncated.");
+  }
+  record = buffer_.Slice(position_, size);
+  position_ += size;
+  if (checksum_ == Checksum::kCrc32c) {
+    const Byte* encoded = buffer_.Data() + position_;
+    std::uint32_t expected = 0;
+    for (std::size_t i = 0; i < 4; i++) {
+      expected |= std::uint32_t(encoded[i].ToInt()) << (8 * i);
+    }
+    position_ += 4;
+    if (Crc32cOf(record.Data(), record.Size()) != expected) {
+      throw std::runtime_error("The checksum of the record doesn't match.");
+    }
+  }
+  return true;
+}
+
+SharedByteVector BinaryReader::ReadBytes() {
+  SharedByteVector record;
+  if (!Next(record)) {
+    throw std::runtime_error("There are no more records to read.");
+  }
+  return record;
+}
+
+ByteVector BinaryReader::ReadByteVector() {
+  return ReadBytes().ToByteVector();
+}
+
+Word BinaryReader::ReadWord() {
+  SharedByteVector record = ReadBytes();
+  return Word(std::vector<Byte>(record.Data(), 
+                                record.Data() + record.Size()));
+}
+
+std::vector<SharedByteVector> BinaryReader::ReadCollection() {
+  std::uint64_t count = ReadVarint();
+  std::vector<SharedByteVector> collection;
+  collection.reserve(std::min<std::uint64_t>(count, buffer_.Size()));
+  for (std::uint64_t i = 0; i < count; i++) {
+    collection.push_back(ReadBytes());
+  }
+  return collection;
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
@@ -0,0 +1,399 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "sha.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#include "byte_blocks.h"
+#include "cpu_features.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define BYTE_UTILS_HAS_SHA_NI 1
+#endif
+
+namespace ByteUtils {
+
+namespace {
+
+constexpr std::uint32_t kSha256K[64] = {
+  0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+  0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+  0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+  0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+  0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+  0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+  0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+  0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+  0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+  0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+  0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+constexpr std::uint64_t kSha512K[80] = {
+  0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 
+  0xe9b5dba58189dbbc, 0x3956c25bf348b538, 0x59f111f1b605d019, 
+  0x923f82a4af194f9b, 0xab1c5ed5da6d8118, 0xd807aa98a3030242, 
+  0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2, 
+  0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 
+  0xc19bf174cf692694, 0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 
+  0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65, 0x2de92c6f592b0275, 
+  0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5, 
+  0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 
+  0xbf597fc7beef0ee4, 0xc6e00bf33da88fc2, 0xd5a79147930aa725, 
+  0x06ca6351e003826f, 0x142929670a0e6e70, 0x27b70a8546d22ffc, 
+  0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df, 
+  0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 
+  0x92722c851482353b, 0xa2bfe8a14cf10364, 0xa81a664bbc423001, 
+  0xc24b8b70d0f89791, 0xc76c51a30654be30, 0xd192e819d6ef5218, 
+  0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8, 
+  0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 
+  0x34b0bcb5e19b48a8, 0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 
+  0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3, 0x748f82ee5defb2fc, 
+  0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec, 
+  0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 
+  0xc67178f2e372532b, 0xca273eceea26619c, 0xd186b8c721c0c207, 
+  0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178, 0x06f067aa72176fba, 
+  0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b, 
+  0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 
+  0x431d67c49c100d4c, 0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 
+  0x5fcb6fab3ad6faec, 0x6c44198c4a475817
+};
+
+inline std::uint32_t Rotr32(std::uint32_t x, int n) {
+  return (x >> n) | (x << (32 - n));
+}
+
+inline std::uint64_t Rotr64(std::uint64_t x, int n) {
+  return (x >> n) | (x << (64 - n));
+}
+
+inline std::uint32_t LoadBig32(const std::uint8_t* data) {
+  return (static_cast<std::uint32_t>(data[0]) << 24) | 
+         (static_cast<std::uint32_t>(data[1]) << 16) |
+         (static_cast<std::uint32_t>(data[2]) << 8) | data[3];
+}
+
+inline std::uint64_t LoadBig64(const std::uint8_t* data) {
+  return (static_cast<std::uint64_t>(LoadBig32(data)) << 32) | 
+         LoadBig32(data + 4);
+}
+
+void Sha256Blocks(std::uint32_t* state, const std::uint8_t* data, 
+                  std::size_t n_blocks) {
+  std::uint32_t w[64];
+  while (n_blocks--) {
+    for (int t = 0; t < 16; t++) {
+      w[t] = LoadBig32(data + t * 4);
+    }
+    for (int t = 16; t < 64; t++) {
+      std::uint32_t s0 = Rotr32(w[t-15], 7) ^ Rotr32(w[t-15], 18) ^ 
+                         (w[t-15] >> 3);
+      std::uint32_t s1 = Rotr32(w[t-2], 17) ^ Rotr32(w[t-2], 19) ^ 
+                         (w[t-2] >> 10);
+      w[t] = w[t-16] + s0 + w[t-7] + s1;
+    }
+    std::uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    std::uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int t = 0; t < 64; t++) {
+      std::uint32_t s1 = Rotr32(e, 6) ^ Rotr32(e, 11) ^ Rotr32(e, 25);
+      std::uint32_t choose = (e & f) ^ (~e & g);
+      std::uint32_t temp1 = h + s1 + choose + kSha256K[t] + w[t];
+      std::uint32_t s0 = Rotr32(a, 2) ^ Rotr32(a, 13) ^ Rotr32(a, 22);
+      std::uint32_t majority = (a & b) ^ (a & c) ^ (b & c);
+      std::uint32_t temp2 = s0 + majority;
+      h = g; g = f; f = e; e = d + temp1;
+      d = c; c = b; b = a; a = temp1 + temp2;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    data += Sha256::kBlockSize;
+  }
+}
+
+#ifdef BYTE_UTILS_HAS_SHA_NI
+// Processes the blocks with the `sha256rnds2`, `sha256msg1` and 
+// `sha256msg2` instructions, 4 rounds per group of instructions.
+__attribute__((target("sha,sse4.1")))
+void Sha256BlocksShaNi(std::uint32_t* state, const std::uint8_t* data,
+                       std::size_t n_blocks) {
+  const __m128i kByteSwap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 
+                                           0x0405060700010203ULL);
+  // Rearranges the state as the ABEF and CDGH halves.
+  __m128i temp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(state));
+  __m128i state1 = _mm_loadu_si128(
+      reinterpret_cast<const __m128i*>(state + 4));
+  temp = _mm_shuffle_epi32(temp, 0xb1);
+  state1 = _mm_shuffle_epi32(state1, 0x1b);
+  __m128i state0 = _mm_alignr_epi8(temp, state1, 8);
+  state1 = _mm_blend_epi16(state1, temp, 0xf0);
+  while (n_blocks--) {
+    __m128i abef = state0;
+    __m128i cdgh = state1;
+    __m128i messages[4];
+    for (int group = 0; group < 16; group++) {
+      __m128i& current = messages[group % 4];
+      if (group < 4) {
+        current = _mm_shuffle_epi8(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 
+                                                             group * 16)),
+            kByteSwap);
+      }
+      __m128i message = _mm_add_epi32(
+          current, _mm_loadu_si128(
+              reinterpret_cast<const __m128i*>(kSha256K + group * 4)));
+      state1 = _mm_sha256rnds2_epu32(state1, state0, message);
+      if (group >= 3 && group < 15) {
+        __m128i& next = messages[(group + 1) % 4];
+        temp = _mm_alignr_epi8(current, messages[(group + 3) % 4], 4);
+        next = _mm_add_epi32(next, temp);
+        next = _mm_sha256msg2_epu32(next, current);
+      }
+      message = _mm_shuffle_epi32(message, 0x0e);
+      state0 = _mm_sha256rnds2_epu32(state0, state1, message);
+      if (group >= 1 && group < 13) {
+        __m128i& previous = messages[(group + 3) % 4];
+        previous = _mm_sha256msg1_epu32(previous, current);
+      }
+    }
+    state0 = _mm_add_epi32(state0, abef);
+    state1 = _mm_add_epi32(state1, cdgh);
+    data += Sha256::kBlockSize;
+  }
+  temp = _mm_shuffle_epi32(state0, 0x1b);
+  state1 = _mm_shuffle_epi32(state1, 0xb1);
+  state0 = _mm_blend_epi16(temp, state1, 0xf0);
+  state1 = _mm_alignr_epi8(state1, temp, 8);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(state), state0);
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(state + 4), state1);
+}
+
+const bool kHasShaNi = __builtin_cpu_supports("sha") && 
+                       __builtin_cpu_supports("sse4.1");
+#endif
+
+void Sha256Compress(std::uint32_t* state, const std::uint8_t* data, 
+                    std::size_t n_blocks) {
+#ifdef BYTE_UTILS_HAS_SHA_NI
+  if (kHasShaNi && !Internal::PortableCodePaths()) {
+    Sha256BlocksShaNi(state, data, n_blocks);
+    return;
+  }
+#endif
+  Sha256Blocks(state, data, n_blocks);
+}
+
+void Sha512Compress(std::uint64_t* state, const std::uint8_t* data, 
+                    std::size_t n_blocks) {
+  std::uint64_t w[80];
+  while (n_blocks--) {
+    for (int t = 0; t < 16; t++) {
+      w[t] = LoadBig64(data + t * 8);
+    }
+    for (int t = 16; t < 80; t++) {
+      std::uint64_t s0 = Rotr64(w[t-15], 1) ^ Rotr64(w[t-15], 8) ^ 
+                         (w[t-15] >> 7);
+      std::uint64_t s1 = Rotr64(w[t-2], 19) ^ Rotr64(w[t-2], 61) ^ 
+                         (w[t-2] >> 6);
+      w[t] = w[t-16] + s0 + w[t-7] + s1;
+    }
+    std::uint64_t a = state[0], b = state[1], c = state[2], d = state[3];
+    std::uint64_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int t = 0; t < 80; t++) {
+      std::uint64_t s1 = Rotr64(e, 14) ^ Rotr64(e, 18) ^ Rotr64(e, 41);
+      std::uint64_t choose = (e & f) ^ (~e & g);
+      std::uint64_t temp1 = h + s1 + choose + kSha512K[t] + w[t];
+      std::uint64_t s0 = Rotr64(a, 28) ^ Rotr64(a, 34) ^ Rotr64(a, 39);
+      std::uint64_t majority = (a & b) ^ (a & c) ^ (b & c);
+      std::uint64_t temp2 = s0 + majority;
+      h = g; g = f; f = e; e = d + temp1;
+      d = c; c = b; b = a; a = temp1 + temp2;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    data += Sha512::kBlockSize;
+  }
+}
+
+// Buffers the input and passes the complete blocks to `compress`.
+template <std::size_t kBlockSize, typename State, typename Compress>
+void Absorb(State& state, std::uint8_t* buffer, std::size_t& buffered,
+            std::uint64_t& length, const std::uint8_t* data, std::size_t size,
+            Compress compress) {
+  length += size;
+  if (buffered > 0) {
+    std::size_t count = std::min(size, kBlockSize - buffered);
+    std::memcpy(buffer + buffered, data, count);
+    buffered += count;
+    data += count;
+    size -= count;
+    if (buffered < kBlockSize) {
+      return;
+    }
+    compress(state.data(), buffer, 1);
+    buffered = 0;
+  }
+  std::size_t n_blocks = size / kBlockSize;
+  if (n_blocks > 0) {
+    compress(state.data(), data, n_blocks);
+    data += n_blocks * kBlockSize;
+    size -= n_blocks * kBlockSize;
+  }
+  std::memcpy(buffer, data, size);
+  buffered = size;
+}
+
+// Appends the `0x80` marker, the zero padding and the message length 
+// in bits stored on `length_size` bytes.
+template <std::size_t kBlockSize, typename State, typename Compress>
+void Pad(State& state, std::uint8_t* buffer, std::size_t buffered, 
+         std::uint64_t length, std::size_t length_size, Compress compress) {
+  buffer[buffered++] = 0x80;
+  if (buffered > kBlockSize - length_size) {
+    std::memset(buffer + buffered, 0, kBlockSize - buffered);
+    compress(state.data(), buffer, 1);
+    buffered = 0;
+  }
+  std::memset(buffer + buffered, 0, kBlockSize - buffered);
+  // The length in bits can exceed 64 bits only for SHA-512 messages.
+  std::uint64_t high = length >> 61;
+  std::uint64_t low = length << 3;
+  for (int index = 0; index < 8; index++) {
+    buffer[kBlockSize - 1 - index] = static_cast<std::uint8_t>(low >> 
+                                                               (index * 8));
+  }
+  if (length_size == 16) {
+    buffer[kBlockSize - 9] = static_cast<std::uint8_t>(high);
+  }
+  compress(state.data(), buffer, 1);
+}
+
+// Reads `stream` until its end and passes the bytes to `update`.
+template <typename Update>
+void ForEachRead(std::istream& stream, Update update) {
+  char block[Internal::kCopyBlockSize];
+  while (stream.read(block, sizeof(block)) || stream.gcount() > 0) {
+    update(reinterpret_cast<const std::uint8_t*>(block), stream.gcount());
+  }
+}
+
+}  // namespace
+
+Sha256::Sha256() {
+  Reset();
+}
+
+ByteVector Sha256::Compute(const ByteVector& bytes) {
+  Sha256 sha;
+  sha.Update(bytes);
+  return sha.Finalize();
+}
+
+void Sha256::Update(const ByteVector& bytes) {
+  Internal::ForEachBlock(bytes, [this](const std::uint8_t* data, 
+                                       std::size_t size) {
+    Update(data, size);
+  });
+}
+
+void Sha256::Update(const std::uint8_t* data, std::size_t size) {
+  Absorb<kBlockSize>(state_, buffer_.data(), buffered_, length_, data, size,
+                     Sha256Compress);
+}
+
+void Sha256::Update(std::istream& stream) {
+  ForEachRead(stream, [this](const std::uint8_t* data, std::size_t size) {
+    Update(data, size);
+  });
+}
+
+ByteVector Sha256::Finalize() {
+  Pad<kBlockSize>(state_, buffer_.data(), buffered_, length_, 8, 
+                  Sha256Compress);
+  std::vector<Byte> digest;
+  digest.reserve(kDigestSize);
+  for (const auto& value : state_) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+      digest.emplace_back(static_cast<std::uint8_t>(value >> shift));
+    }
+  }
+  Reset();
+  return ByteVector(std::move(digest));
+}
+
+void Sha256::Reset() {
+  state_ = {0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+            0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19};
+  buffered_ = 0;
+  length_ = 0;
+}
+
+Sha512::Sha512() {
+  Reset();
+}
+
+ByteVector Sha512::Compute(const ByteVector& bytes) {
+  Sha512 sha;
+  sha.Update(bytes);
+  return sha.Finalize();
+}
+
+void Sha512::Update(const ByteVector& bytes) {
+  Internal::ForEachBlock(bytes, [this](const std::uint8_t* data, 
+                                       std::size_t size) {
+    Update(data, size);
+  });
+}
+
+void Sha512::Update(const std::uint8_t* data, std::size_t size) {
+  Absorb<kBlockSize>(state_, buffer_.data(), buffered_, length_, data, size,
+                     Sha512Compress);
+}
+
+void Sha512::Update(std::istream& stream) {
+  ForEachRead(stream, [this](const std::uint8_t* data, std::size_t size) {
+    Update(data, size);
+  });
+}
+
+ByteVector Sha512::Finalize() {
+  Pad<kBlockSize>(state_, buffer_.data(), buffered_, length_, 16, 
+                  Sha512Compress);
+  std::vector<Byte> digest;
+  digest.reserve(kDigestSize);
+  for (const auto& value : state_) {
+    for (int shift = 56; shift >= 0; shift -= 8) {
+      digest.emplace_back(static_cast<std::uint8_t>(value >> shift));
+    }
+  }
+  Reset();
+  return ByteVector(std::move(digest));
+}
+
+void Sha512::Reset() {
+  state_ = {0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b,
+            0xa54ff53a5f1d36f1, 0x510e527fade682d1, 0x9b05688c2b3e6c1f,
+            0x1f83d9abfb41bd6b, 0x5be0cd19137e2179};
+  buffered_ = 0;
+  length_ = 0;
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
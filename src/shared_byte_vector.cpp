@@ -0,0 +1,89 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "shared_byte_vector.h"
+
+#include <atomic>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace ByteUtils {
+
+SharedByteVector::SharedByteVector()
+    : buffer_(std::make_shared<std::vector<Byte>>()) {}
+
+SharedByteVector::SharedByteVector(const ByteVector& bytes)
+    : buffer_(std::make_shared<std::vector<Byte>>(bytes.bytes_)),
+      size_(bytes.Size()) {}
+
+SharedByteVector::SharedByteVector(ByteVector&& bytes)
+    : buffer_(std::make_shared<std::vector<Byte>>(std::move(bytes.bytes_))),
+      size_(buffer_->size()) {}
+
+SharedByteVector::SharedByteVector(std::shared_ptr<std::vector<Byte>> buffer,
+                                   std::size_t offset, std::size_t size)
+    : buffer_(std::move(buffer)), offset_(offset), size_(size) {}
+
+void SharedByteVector::Set(const std::size_t pos, const Byte& byte) {
+  Internal::CheckIndex(pos, size_);
+  DetachIfShared();
+  (*buffer_)[offset_ + pos] = byte;
+}
+
+void SharedByteVector::Substitute(const std::array<Byte, 256>& table) {
+  DetachIfShared();
+  for (std::size_t pos = offset_; pos < offset_ + size_; pos++) {
+    (*buffer_)[pos] = table[(*buffer_)[pos].ToInt()];
+  }
+}
+
+SharedByteVector SharedByteVector::Slice(std::size_t offset, 
+                                         std::size_t length) const {
+  if (offset > size_ || length > size_ - offset) {
+    throw std::out_of_range("The slice is out of range.");
+  }
+  return SharedByteVector(buffer_, offset_ + offset, length);
+}
+
+ByteVector SharedByteVector::ToByteVector() const {
+  return ByteVector(std::vector<Byte>(buffer_->begin() + offset_, 
+                                      buffer_->begin() + offset_ + size_));
+}
+
+std::string SharedByteVector::ToHex() const {
+  std::stringstream stream;
+  for (const auto& byte : *this) {
+    stream << byte.ToHex();
+  }
+  return stream.str();
+}
+
+void SharedByteVector::DetachIfShared() {
+  if (buffer_.use_count() == 1) {
+    // The count is loaded with relaxed ordering; the fence orders the 
+    // writes after the reads of the views released by other threads.
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return;
+  }
+  buffer_ = std::make_shared<std::vector<Byte>>(
+      buffer_->begin() + offset_, buffer_->begin() + offset_ + size_);
+  offset_ = 0;
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
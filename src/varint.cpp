@@ -0,0 +1,280 @@
+/* 
+  Copyright (C) 2023 Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "varint.h"
+
+#include <array>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "cpu_features.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <tmmintrin.h>
+#define BYTE_UTILS_HAS_SSSE3_VARINT 1
+#endif
+
+namespace ByteUtils {
+
+namespace {
+
+constexpr std::uint64_t kContinuationBits = 0x8080808080808080;
+
+// Loads 8 bytes as a little-endian value, so the first byte is always 
+// the least significant one.
+inline std::uint64_t Read64(const std::uint8_t* data) {
+  std::uint64_t value;
+  std::memcpy(&value, data, sizeof(value));
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  value = __builtin_bswap64(value);
+#endif
+  return value;
+}
+
+// Packs the 7-bit groups of the little-endian bytes of `word`, whose 
+// continuation bits are already cleared, into a value of up to 56 bits.
+inline std::uint64_t Compact(std::uint64_t word) {
+  word = ((word & 0x7f007f007f007f00) >> 1) | (word & 0x007f007f007f007f);
+  word = ((word & 0x3fff00003fff0000) >> 2) | (word & 0x00003fff00003fff);
+  return ((word & 0x0fffffff00000000) >> 4) | (word & 0x000000000fffffff);
+}
+
+// Decodes one varint with a byte-by-byte loop, advancing `position`.
+template <typename T>
+T DecodeOne(const std::uint8_t* data, std::size_t size, 
+            std::size_t& position) {
+  constexpr std::size_t kBits = std::numeric_limits<T>::digits;
+  std::uint64_t value = 0;
+  for (std::size_t shift = 0; shift < kBits; shift += 7) {
+    if (position == size) {
+      throw std::runtime_error("The varint is truncated.");
+    }
+    std::uint8_t byte = data[position++];
+    // The last group can't carry more bits than the type has left.
+    if (kBits - shift < 7 && (byte >> (kBits - shift)) != 0) {
+      break;
+    }
+    value |= std::uint64_t(byte & 0x7f) << shift;
+    if (!(byte & 0x80)) {
+      return static_cast<T>(value);
+    }
+  }
+  throw std::runtime_error("The varint doesn't fit in " + 
+                           std::to_string(kBits) + " bits.");
+}
+
+// Decodes the varints from the 8 bytes starting from `position`, which 
+// must be readable: the terminating bytes are found from the continuation 
+// bits, so a run of 1-byte varints is emitted at once and a longer varint 
+// is assembled without a loop over its bytes.
+template <typename T>
+inline void DecodeWord(const std::uint8_t* data, std::size_t size, 
+                       std::size_t& position, std::vector<T>& values) {
+  constexpr std::size_t kMaxFastSize = 
+      std::numeric_limits<T>::digits == 32 ? kMaxVarint32Size - 1 : 8;
+  std::uint64_t word = Read64(data + position);
+  std::uint64_t terminators = ~word & kContinuationBits;
+  if (terminators == kContinuationBits) {
+    for (std::size_t i = 0; i < 8; i++) {
+      values.push_back(data[position + i]);
+    }
+    position += 8;
+    return;
+  }
+  std::size_t length = terminators ? __builtin_ctzll(terminators) / 8 + 1
+                                   : kMaxVarint64Size;
+  if (length > kMaxFastSize) {
+    values.push_back(DecodeOne<T>(data, size, position));
+    return;
+  }
+  std::uint64_t mask = length == 8 ? ~std::uint64_t(0) 
+                                   : (std::uint64_t(1) << (length * 8)) - 1;
+  values.push_back(static_cast<T>(Compact(word & mask & ~kContinuationBits)));
+  position += length;
+}
+
+// Decodes the varints from `position` to the end of the data, 8 bytes at 
+// a time while possible.
+template <typename T>
+void DecodeFrom(const std::uint8_t* data, std::size_t size, 
+                std::size_t position, std::vector<T>& values) {
+  while (position + 8 <= size) {
+    DecodeWord(data, size, position, values);
+  }
+  while (position < size) {
+    values.push_back(DecodeOne<T>(data, size, position));
+  }
+}
+
+#ifdef BYTE_UTILS_HAS_SSSE3_VARINT
+using ShuffleTable = std::array<std::array<std::uint8_t, 16>, 256>;
+
+// Builds the `pshufb` masks that move 4 consecutive varints of 1 to 4 
+// bytes into the 32-bit lanes of a register. The index holds the length 
+// minus one of each varint in 2 bits, starting from the lowest bits.
+constexpr ShuffleTable MakeShuffleTable() {
+  ShuffleTable table{};
+  for (std::size_t index = 0; index < table.size(); index++) {
+    std::size_t source = 0;
+    for (std::size_t lane = 0; lane < 4; lane++) {
+      std::size_t length = ((index >> (2 * lane)) & 3) + 1;
+      for (std::size_t byte = 0; byte < 4; byte++) {
+        // A mask byte with the high bit set clears the destination byte.
+        table[index][4 * lane + byte] = static_cast<std::uint8_t>(
+            byte < length ? source + byte : 0x80);
+      }
+      source += length;
+    }
+  }
+  return table;
+}
+
+constexpr ShuffleTable kShuffleTable = MakeShuffleTable();
+
+// Decodes 16 bytes at a time: when the next 4 varints have at most 4 
+// bytes each, `pshufb` moves them into the 32-bit lanes of a register 
+// and their 7-bit groups are packed in all the lanes at once. The other 
+// varints are decoded by `DecodeWord`.
+template <typename T>
+__attribute__((target("ssse3")))
+void DecodeSsse3(const std::uint8_t* data, std::size_t size, 
+                 std::vector<T>& values) {
+  const __m128i low_groups = _mm_set1_epi32(0x007f007f);
+  const __m128i high_groups = _mm_set1_epi32(0x7f007f00);
+  const __m128i low_pairs = _mm_set1_epi32(0x00003fff);
+  const __m128i high_pairs = _mm_set1_epi32(0x3fff0000);
+  std::size_t position = 0;
+  while (position + 16 <= size) {
+    __m128i bytes = _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(data + position));
+    unsigned terminators = ~_mm_movemask_epi8(bytes) & 0xffff;
+    if (terminators == 0xffff) {
+      values.insert(values.end(), data + position, data + position + 16);
+      position += 16;
+      continue;
+    }
+    // Finds the lengths of the next 4 varints from their terminating bytes.
+    std::size_t index = 0;
+    std::size_t length = 0;
+    std::size_t lane = 0;
+    for (; lane < 4 && terminators != 0; lane++) {
+      std::size_t end = __builtin_ctz(terminators) + 1;
+      if (end - length > 4) {
+        break;
+      }
+      index |= (end - length - 1) << (2 * lane);
+      length = end;
+      terminators &= terminators - 1;
+    }
+    if (lane < 4) {
+      DecodeWord(data, size, position, values);
+      continue;
+    }
+    __m128i lanes = _mm_shuffle_epi8(bytes, _mm_loadu_si128(
+        reinterpret_cast<const __m128i*>(kShuffleTable[index].data())));
+    lanes = _mm_or_si128(_mm_and_si128(lanes, low_groups), 
+        _mm_srli_epi32(_mm_and_si128(lanes, high_groups), 1));
+    lanes = _mm_or_si128(_mm_and_si128(lanes, low_pairs), 
+        _mm_srli_epi32(_mm_and_si128(lanes, high_pairs), 2));
+    std::uint32_t decoded[4];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(decoded), lanes);
+    values.insert(values.end(), decoded, decoded + 4);
+    position += length;
+  }
+  DecodeFrom(data, size, position, values);
+}
+
+const bool kHasSsse3 = __builtin_cpu_supports("ssse3");
+#endif
+
+template <typename T>
+void Decode(const std::uint8_t* data, std::size_t size, 
+            std::vector<T>& values) {
+#ifdef BYTE_UTILS_HAS_SSSE3_VARINT
+  if (kHasSsse3 && !Internal::PortableCodePaths()) {
+    DecodeSsse3(data, size, values);
+    return;
+  }
+#endif
+  DecodeFrom(data, size, 0, values);
+}
+
+template <typename T>
+ByteVector Encode(const std::vector<T>& values) {
+  std::vector<std::uint8_t> encoded(values.size() * kMaxVarint64Size);
+  std::size_t size = 0;
+  for (const auto& value : values) {
+    size += EncodeVarint(value, encoded.data() + size);
+  }
+  return ByteVector(std::vector<Byte>(encoded.begin(), 
+                                      encoded.begin() + size));
+}
+
+template <typename T>
+void DecodeBytes(const ByteVector& bytes, std::vector<T>& values) {
+  std::vector<std::uint8_t> data;
+  data.reserve(bytes.Size());
+  for (const auto& byte : bytes) {
+    data.push_back(byte.ToInt());
+  }
+  Decode(data.data(), data.size(), values);
+}
+
+}  // namespace
+
+std::size_t EncodeVarint(std::uint64_t value, std::uint8_t* out) {
+  std::size_t size = 0;
+  while (value >= 0x80) {
+    out[size++] = static_cast<std::uint8_t>(value) | 0x80;
+    value >>= 7;
+  }
+  out[size++] = static_cast<std::uint8_t>(value);
+  return size;
+}
+
+ByteVector EncodeVarints(const std::vector<std::uint32_t>& values) {
+  return Encode(values);
+}
+
+ByteVector EncodeVarints(const std::vector<std::uint64_t>& values) {
+  return Encode(values);
+}
+
+void DecodeVarints(const std::uint8_t* data, std::size_t size, 
+                   std::vector<std::uint32_t>& values) {
+  Decode(data, size, values);
+}
+
+void DecodeVarints(const std::uint8_t* data, std::size_t size, 
+                   std::vector<std::uint64_t>& values) {
+  Decode(data, size, values);
+}
+
+void DecodeVarints(const ByteVector& bytes, 
+                   std::vector<std::uint32_t>& values) {
+  DecodeBytes(bytes, values);
+}
+
+void DecodeVarints(const ByteVector& bytes, 
+                   std::vector<std::uint64_t>& values) {
+  DecodeBytes(bytes, values);
+}
+
+}  // namespace ByteUtils
\ No newline at end of file
@@ -18,10 +18,12 @@
 */
 #include "word.h"
 
+#include <algorithm>
 #include <iostream>
 #include <regex>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 
 namespace ByteUtils {
 
@@ -82,108 +84,243 @@ std::ostream& operator<<(std::ostream& stream, const Word& data) {
   return stream;
 }
 
-Word Word::operator^(const Word& word) const {
+Word Word::operator^(const Word& word) const & {
+  Word result = *this;
+  result ^= word;
+  return result;
+}
+
+Word Word::operator^(const Word& word) && {
+  *this ^= word;
+  return std::move(*this);
+}
+
+Word Word::operator^(const Byte& byte) const & {
+  Word result = *this;
+  result ^= byte;
+  return result;
+}
+
+Word Word::operator^(const Byte& byte) && {
+  *this ^= byte;
+  return std::move(*this);
+}
+
+Word Word::operator&(const Word& word) const & {
+  Word result = *this;
+  result &= word;
+  return result;
+}
+
+Word Word::operator&(const Word& word) && {
+  *this &= word;
+  return std::move(*this);
+}
+
+Word Word::operator|(const Word& word) const & {
+  Word result = *this;
+  result |= word;
+  return result;
+}
+
+Word Word::operator|(const Word& word) && {
+  *this |= word;
+  return std::move(*this);
+}
+
+Word Word::operator~() const & {
+  return ~Word(*this);
+}
+
+Word Word::operator~() && {
+  for (auto& byte : word_) {
+    byte = ~byte;
+  }
+  return std::move(*this);
+}
+
+Word Word::operator<<(std::size_t n_pos) const & {
+  Word result = *this;
+  result <<= n_pos;
+  return result;
+}
+
+Word Word::operator<<(std::size_t n_pos) && {
+  *this <<= n_pos;
+  return std::move(*this);
+}
+
+Word Word::operator>>(std::size_t n_pos) const & {
+  Word result = *this;
+  result >>= n_pos;
+  return result;
+}
+
+Word Word::operator>>(std::size_t n_pos) && {
+  *this >>= n_pos;
+  return std::move(*this);
+}
+
+Word Word::operator+(const Word& word) const & {
+  Word result = *this;
+  result += word;
+  return result;
+}
+
+Word Word::operator+(const Word& word) && {
+  *this += word;
+  return std::move(*this);
+}
+
+Word Word::operator-(const Word& word) const & {
+  Word result = *this;
+  result -= word;
+  return result;
+}
+
+Word Word::operator-(const Word& word) && {
+  *this -= word;
+  return std::move(*this);
+}
+
+Word Word::RotateLeft(std::size_t n_pos) const {
+  const std::size_t bits = word_.size() * 8;
+  if (bits == 0 || n_pos % bits == 0) {
+    return *this;
+  }
+  n_pos %= bits;
+  return (*this << n_pos) | (*this >> (bits - n_pos));
+}
+
+Word Word::RotateRight(std::size_t n_pos) const {
+  const std::size_t bits = word_.size() * 8;
+  if (bits == 0 || n_pos % bits == 0) {
+    return *this;
+  }
+  n_pos %= bits;
+  return (*this >> n_pos) | (*this << (bits - n_pos));
+}
+
+Word& Word::operator+=(const Word& word) {
   if (word_.size() != word.Size()) {
-    throw std::runtime_error("Can't perform XOR operation between words " 
+    throw std::runtime_error("Can't perform addition between words " 
                              "with different sizes.");
   }
-  std::vector<Byte> result;
-  for (std::size_t index = 0; index < 4; index++) {
-    result.emplace_back(word_[index] ^ word.word_[index]);
+  // Adds from the LSB towards the MSB, dropping the final carry.
+  unsigned int carry = 0;
+  for (std::size_t index = word_.size(); index-- > 0; ) {
+    unsigned int sum = word_[index].ToInt() + word.word_[index].ToInt() + 
+                       carry;
+    word_[index] = static_cast<std::uint8_t>(sum);
+    carry = sum >> 8;
   }
-  return result;
+  return *this;
 }
 
-Word Word::operator^(const Byte& byte) const {
-  std::vector<Byte> result;
-  for (std::size_t index = 0; index < 4 ; index++) {
-    result.emplace_back(word_[index] ^ byte);
+Word& Word::operator-=(const Word& word) {
+  if (word_.size() != word.Size()) {
+    throw std::runtime_error("Can't perform subtraction between words " 
+                             "with different sizes.");
   }
-  return result;
+  // Subtracts from the LSB towards the MSB, dropping the final borrow.
+  int borrow = 0;
+  for (std::size_t index = word_.size(); index-- > 0; ) {
+    int difference = word_[index].ToInt() - word.word_[index].ToInt() - 
+                     borrow;
+    borrow = difference < 0;
+    word_[index] = static_cast<std::uint8_t>(difference + (borrow << 8));
+  }
+  return *this;
 }
 
-Word Word::operator&(const Word& word) const {
+Word& Word::operator^=(const Word& word) {
   if (word_.size() != word.Size()) {
     throw std::runtime_error("Can't perform XOR operation between words " 
                              "with different sizes.");
   }
-  std::vector<Byte> result;
   for (std::size_t index = 0; index < word_.size(); index++) {
-    result.emplace_back(word_[index] & word[index]);
+    word_[index] ^= word.word_[index];
   }
-  return result;
+  return *this;
+}
+
+Word& Word::operator^=(const Byte& byte) {
+  for (auto& w : word_) {
+    w ^= byte;
+  }
+  return *this;
 }
 
-Word Word::operator|(const Word& word) const {
+Word& Word::operator&=(const Word& word) {
   if (word_.size() != word.Size()) {
-    throw std::runtime_error("Can't perform XOR operation between words " 
+    throw std::runtime_error("Can't perform AND operation between words " 
                              "with different sizes.");
   }
-  std::vector<Byte> result;
   for (std::size_t index = 0; index < word_.size(); index++) {
-    result.emplace_back(word_[index] | word[index]);
+    word_[index] = word_[index] & word.word_[index];
   }
-  return result;
+  return *this;
 }
 
-Word Word::operator~() const {
-  std::vector<Byte> result;
-  for (const auto& w : word_) {
-    result.emplace_back(~w);
+Word& Word::operator|=(const Word& word) {
+  if (word_.size() != word.Size()) {
+    throw std::runtime_error("Can't perform OR operation between words " 
+                             "with different sizes.");
   }
-  return result;
+  for (std::size_t index = 0; index < word_.size(); index++) {
+    word_[index] = word_[index] | word.word_[index];
+  }
+  return *this;
 }
 
-Word Word::operator<<(std::size_t n_pos) const {
+Word& Word::operator<<=(std::size_t n_pos) {
   if (n_pos > word_.size() * 8) {
     throw std::out_of_range("n_pos is out of range.");
   }
-  Word word = *this;
-  while (n_pos--) {
-    bool carry = false;
-    for (auto byte = word.rbegin(); byte != word.rend(); ++byte) {
-      bool new_carry = (*byte)[7];
-      (*byte) <<= 1;
-      if (carry) {
-        (*byte)[0] = 1;
-      }
-      carry = new_carry;
-    }
+  // Moves whole bytes first, then carries the remaining bits 
+  // from the byte positioned towards the LSB.
+  const std::size_t size = word_.size();
+  const std::size_t n_bytes = n_pos / 8;
+  const std::size_t n_bits = n_pos % 8;
+  for (std::size_t index = 0; index < size; index++) {
+    std::size_t source = index + n_bytes;
+    unsigned int high = source < size ? word_[source].ToInt() : 0;
+    unsigned int low = source + 1 < size ? word_[source+1].ToInt() : 0;
+    word_[index] = static_cast<std::uint8_t>((high << n_bits) | 
+                                             (low >> (8 - n_bits)));
   }
-  return word;
+  return *this;
 }
 
-Word Word::operator>>(std::size_t n_pos) const {
+Word& Word::operator>>=(std::size_t n_pos) {
   if (n_pos > word_.size() * 8) {
     throw std::out_of_range("n_pos is out of range.");
   }
-  Word word = *this;
-  while (n_pos--) {
-    bool carry = false;
-    for (auto& byte : word) {
-      bool new_carry = byte[0];
-      byte >>= 1;
-      if (carry) {
-        byte[7] = 1;
-      }
-      carry = new_carry;
-    }
+  // Moves whole bytes first, then carries the remaining bits 
+  // from the byte positioned towards the MSB.
+  const std::size_t n_bytes = n_pos / 8;
+  const std::size_t n_bits = n_pos % 8;
+  for (std::size_t index = word_.size(); index-- > 0; ) {
+    unsigned int low = index >= n_bytes ? word_[index-n_bytes].ToInt() : 0;
+    unsigned int high = index >= n_bytes + 1 ? 
+                        word_[index-n_bytes-1].ToInt() : 0;
+    word_[index] = static_cast<std::uint8_t>((low >> n_bits) | 
+                                             (high << (8 - n_bits)));
   }
-  return word;
+  return *this;
 }
 
-Byte Word::operator[](const std::size_t pos) const {
-  if (pos > 3) {
-    throw std::out_of_range("The position `pos` is out of range.");
-  }
-  return word_[pos];
+bool Word::operator==(const Word& word) const {
+  return word_ == word.word_;
 }
 
-Byte& Word::operator[](const std::size_t pos) {
-  if (pos > 3) {
-    throw std::out_of_range("The position `pos` is out of range.");
-  }
-  return word_[pos];
+bool Word::operator!=(const Word& word) const {
+  return word_ != word.word_;
+}
+
+bool Word::operator<(const Word& word) const {
+  return std::lexicographical_compare(word_.begin(), word_.end(),
+                                      word.word_.begin(), word.word_.end());
 }
 
 void Word::PushBack(const Byte& byte) {
@@ -195,6 +332,32 @@ void Word::PushBack(const Byte& byte) {
   word_.push_back(byte);
 }
 
+void Word::Substitute(const std::array<Byte, 256>& table) {
+  for (auto& byte : word_) {
+    byte = table[byte.ToInt()];
+  }
+}
+
+void Word::ReverseBits() {
+  for (auto& byte : word_) {
+    byte.ReverseBits();
+  }
+}
+
+void Word::ReverseBytes() {
+  std::reverse(word_.begin(), word_.end());
+}
+
+Word ReverseBits(Word word) {
+  word.ReverseBits();
+  return word;
+}
+
+Word ReverseBytes(Word word) {
+  word.ReverseBytes();
+  return word;
+}
+
 std::string Word::ToHex() const {
   std::stringstream stream;
   for (const auto& byte : word_) {
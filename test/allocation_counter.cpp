@@ -0,0 +1,66 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include "allocation_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+// The threaded tests allocate concurrently, so the counter is atomic; 
+// only the total matters, so relaxed increments are enough.
+std::atomic<std::size_t> allocations(0);
+std::atomic<std::size_t> failing_allocation(0);
+
+}  // namespace
+
+namespace AllocationCounter {
+
+void Reset() { allocations.store(0, std::memory_order_relaxed); }
+
+void FailAt(std::size_t allocation) { 
+  failing_allocation.store(allocation, std::memory_order_relaxed); 
+}
+
+std::size_t Count() { 
+  return allocations.load(std::memory_order_relaxed); 
+}
+
+}  // namespace AllocationCounter
+
+void* operator new(std::size_t size) {
+  std::size_t allocation = 
+      allocations.fetch_add(1, std::memory_order_relaxed) + 1;
+  if (allocation == failing_allocation.load(std::memory_order_relaxed)) {
+    throw std::bad_alloc();
+  }
+  if (void* pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);
+}
\ No newline at end of file
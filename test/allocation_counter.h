@@ -0,0 +1,38 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#ifndef BYTE_UTILS_TEST_ALLOCATION_COUNTER_H_
+#define BYTE_UTILS_TEST_ALLOCATION_COUNTER_H_
+
+#include <cstddef>
+
+// Counts the calls to the global `operator new` made between 
+// `Reset()` and `Count()`, used to check that expressions reuse storage.
+// `FailAt()` makes one of the following calls throw `std::bad_alloc`, 
+// used to check that the code cleans up when an allocation fails.
+namespace AllocationCounter {
+
+void Reset();
+std::size_t Count();
+// Makes the call number `allocation`, counted from `Reset()`, throw 
+// `std::bad_alloc`. `0` disables the failure.
+void FailAt(std::size_t allocation);
+
+}  // namespace AllocationCounter
+
+#endif  // BYTE_UTILS_TEST_ALLOCATION_COUNTER_H_
\ No newline at end of file
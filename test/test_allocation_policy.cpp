@@ -0,0 +1,81 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <sched.h>
+
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include "../include/allocation_policy.h"
+#include "../include/byte_vector.h"
+
+TEST(TestAllocationPolicy, TestHugePages) {
+  ByteUtils::AllocationPolicy policy;
+  policy.huge_pages = true;
+  ByteUtils::ByteVector bytes(8 << 20, policy);
+  EXPECT_EQ(bytes.Size(), 8 << 20);
+  EXPECT_EQ(bytes.Count(ByteUtils::Byte(0x00)), bytes.Size());
+  bytes[100] = ByteUtils::Byte(0xab);
+  EXPECT_STREQ(bytes[100].ToHex().c_str(), "ab");
+}
+
+TEST(TestAllocationPolicy, TestNumaNode) {
+  ByteUtils::AllocationPolicy policy;
+  policy.numa_node = 1 << 20;
+  EXPECT_THROW(ByteUtils::ByteVector(4096, policy), std::invalid_argument);
+  if (!std::ifstream("/sys/devices/system/node/node0/cpulist")) {
+    GTEST_SKIP() << "NUMA topology is not available.";
+  }
+  policy.numa_node = 0;
+  ByteUtils::ByteVector bytes(1 << 20, policy);
+  EXPECT_EQ(bytes.Size(), 1 << 20);
+  EXPECT_FALSE(bytes[0].IsAnySet());
+}
+
+TEST(TestAllocationPolicy, TestFailedAllocation) {
+  if (!std::ifstream("/sys/devices/system/node/node0/cpulist")) {
+    GTEST_SKIP() << "NUMA topology is not available.";
+  }
+  cpu_set_t original_cpus;
+  ASSERT_EQ(sched_getaffinity(0, sizeof(original_cpus), &original_cpus), 0);
+  if (CPU_COUNT(&original_cpus) < 2) {
+    GTEST_SKIP() << "Pinning can't change the affinity of a single CPU.";
+  }
+  // Pins the thread to one CPU, so that pinning it to the node changes 
+  // its affinity.
+  cpu_set_t single_cpu;
+  CPU_ZERO(&single_cpu);
+  for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+    if (CPU_ISSET(cpu, &original_cpus)) {
+      CPU_SET(cpu, &single_cpu);
+      break;
+    }
+  }
+  ASSERT_EQ(sched_setaffinity(0, sizeof(single_cpu), &single_cpu), 0);
+  ByteUtils::AllocationPolicy policy;
+  policy.numa_node = 0;
+  EXPECT_THROW(ByteUtils::ByteVector(SIZE_MAX, policy), std::length_error);
+  cpu_set_t cpus;
+  ASSERT_EQ(sched_getaffinity(0, sizeof(cpus), &cpus), 0);
+  EXPECT_TRUE(CPU_EQUAL(&cpus, &single_cpu));
+  sched_setaffinity(0, sizeof(original_cpus), &original_cpus);
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/bit_matrix.h"
+#include "../include/byte_vector.h"
+#include "../include/cpu_features.h"
+
+namespace {
+
+// Returns the bit from the row `row` and column `column` of a square 
+// matrix with rows of `size` bits stored in 64-bit values.
+bool Bit(std::uint64_t row_bits, std::size_t column, std::size_t size) {
+  return (row_bits >> (size - 1 - column)) & 1;
+}
+
+}  // namespace
+
+TEST(TestBitMatrix, TestTranspose8x8) {
+  std::uint64_t matrix = 0x0123456789abcdef;
+  std::uint64_t transposed = ByteUtils::Transpose8x8(matrix);
+  for (std::size_t row = 0; row < 8; row++) {
+    for (std::size_t column = 0; column < 8; column++) {
+      std::uint64_t original_row = matrix >> (56 - column * 8) & 0xff;
+      std::uint64_t transposed_row = transposed >> (56 - row * 8) & 0xff;
+      ASSERT_EQ(Bit(transposed_row, column, 8), Bit(original_row, row, 8));
+    }
+  }
+  EXPECT_EQ(ByteUtils::Transpose8x8(transposed), matrix);
+}
+
+TEST(TestBitMatrix, TestTranspose64x64) {
+  std::array<std::uint64_t, 64> matrix;
+  std::uint64_t state = 0x9e3779b97f4a7c15;
+  for (auto& row : matrix) {
+    state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+    row = state;
+  }
+  std::array<std::uint64_t, 64> transposed = matrix;
+  ByteUtils::Transpose64x64(transposed);
+  for (std::size_t row = 0; row < 64; row++) {
+    for (std::size_t column = 0; column < 64; column++) {
+      ASSERT_EQ(Bit(transposed[row], column, 64), 
+                Bit(matrix[column], row, 64));
+    }
+  }
+}
+
+TEST(TestBitMatrix, TestTransposeBits) {
+  // An 8x16 matrix becomes a 16x8 matrix.
+  ByteUtils::ByteVector block("8000400020001000080004000200017f");
+  ByteUtils::ByteVector transposed = ByteUtils::TransposeBits(block, 8);
+  std::string output = transposed.ToHex();
+  std::string expected_output = "8040201008040201" "0001010101010101";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  EXPECT_STREQ(ByteUtils::TransposeBits(transposed, 16).ToHex().c_str(), 
+               block.ToHex().c_str());
+  EXPECT_THROW(ByteUtils::TransposeBits(block, 4), std::invalid_argument);
+}
+
+TEST(TestBitMatrix, TestPortableTransposeBits) {
+  // 72 rows take two groups of 32 rows and one 8-row tile.
+  const std::size_t rows = 72;
+  const std::size_t row_bytes = 3;
+  std::vector<ByteUtils::Byte> bytes;
+  std::uint64_t state = 0x2545f4914f6cdd1d;
+  for (std::size_t index = 0; index < rows * row_bytes; index++) {
+    state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+    bytes.emplace_back(static_cast<std::uint8_t>(state));
+  }
+  ByteUtils::ByteVector block(bytes);
+  ByteUtils::ByteVector transposed = ByteUtils::TransposeBits(block, rows);
+  ByteUtils::UsePortableCodePaths(true);
+  ByteUtils::ByteVector portable = ByteUtils::TransposeBits(block, rows);
+  ByteUtils::UsePortableCodePaths(false);
+  EXPECT_STREQ(transposed.ToHex().c_str(), portable.ToHex().c_str());
+  for (std::size_t row = 0; row < row_bytes * 8; row++) {
+    for (std::size_t column = 0; column < rows; column++) {
+      ASSERT_EQ(Bit(transposed[row * rows / 8 + column / 8].ToInt(), 
+                    column % 8, 8),
+                Bit(block[column * row_bytes + row / 8].ToInt(), row % 8, 8));
+    }
+  }
+}
+
+TEST(TestBitMatrix, TestBitslicedBytes) {
+  std::string hex;
+  for (int value = 0; value < 64; value++) {
+    hex += ByteUtils::Byte(value * 37 + 11).ToHex();
+  }
+  ByteUtils::ByteVector bytes(hex);
+  ByteUtils::ByteVector key(std::string(128, 'a'));
+  ByteUtils::BitslicedBytes lanes(bytes);
+  EXPECT_STREQ(lanes.ToByteVector().ToHex().c_str(), hex.c_str());
+  EXPECT_STREQ(lanes.Lane(5).ToHex().c_str(), bytes[5].ToHex().c_str());
+  ByteUtils::BitslicedBytes result = ~(lanes ^ ByteUtils::BitslicedBytes(key));
+  EXPECT_STREQ(result.ToByteVector().ToHex().c_str(), 
+               (~(bytes ^ key)).ToHex().c_str());
+}
+
+TEST(TestBitMatrix, TestBitslicedPlanes) {
+  ByteUtils::BitslicedBytes lanes(ByteUtils::ByteVector("010101"));
+  EXPECT_EQ(lanes[0], 0x7);
+  for (std::size_t bit = 1; bit < 8; bit++) {
+    EXPECT_EQ(lanes[bit], 0);
+  }
+  lanes[7] = ~std::uint64_t(0);
+  EXPECT_STREQ(lanes.ToByteVector(4).ToHex().c_str(), "81818180");
+  lanes[3] = std::uint64_t(1) << 40;
+  EXPECT_STREQ(lanes.Lane(40).ToHex().c_str(), "88");
+  EXPECT_THROW(lanes[8], std::out_of_range);
+  EXPECT_THROW(lanes.Lane(64), std::out_of_range);
+}
\ No newline at end of file
@@ -0,0 +1,88 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+#include "../include/bit_stream.h"
+#include "../include/byte_vector.h"
+#include "../include/shared_byte_vector.h"
+
+TEST(TestBitStream, TestReadMsbFirst) {
+  ByteUtils::ByteVector bytes("a5f00f3c");
+  ByteUtils::BitReader reader(bytes);
+  EXPECT_EQ(reader.Read(4), 0xa);
+  EXPECT_EQ(reader.Peek(8), 0x5f);
+  reader.Skip(2);
+  EXPECT_EQ(reader.Read(10), 0x1f0);
+  reader.AlignToByte();
+  EXPECT_EQ(reader.BitsLeft(), 16);
+  EXPECT_EQ(reader.Read(16), 0x0f3c);
+  EXPECT_THROW(reader.Read(1), std::out_of_range);
+}
+
+TEST(TestBitStream, TestReadLsbFirst) {
+  ByteUtils::SharedByteVector bytes(ByteUtils::ByteVector("a5f00f3c"));
+  ByteUtils::BitReader reader(bytes.Slice(1, 3), 
+                              ByteUtils::BitOrder::kLsbFirst);
+  EXPECT_EQ(reader.Read(4), 0x0);
+  EXPECT_EQ(reader.Read(8), 0xff);
+  EXPECT_EQ(reader.Read(12), 0x3c0);
+}
+
+TEST(TestBitStream, TestWideFields) {
+  ByteUtils::ByteVector bytes("0123456789abcdeffedcba9876543210ff");
+  ByteUtils::BitReader reader(bytes);
+  EXPECT_EQ(reader.Read(4), 0x0);
+  EXPECT_EQ(reader.Read(64), 0x123456789abcdeffULL);
+  reader.Skip(56);
+  EXPECT_EQ(reader.Read(8), 0x0f);
+  ByteUtils::BitReader lsb_reader(bytes, ByteUtils::BitOrder::kLsbFirst);
+  EXPECT_EQ(lsb_reader.Read(64), 0xefcdab8967452301ULL);
+}
+
+TEST(TestBitStream, TestWriteRoundTrip) {
+  for (auto order : {ByteUtils::BitOrder::kMsbFirst, 
+                     ByteUtils::BitOrder::kLsbFirst}) {
+    ByteUtils::BitWriter writer(order);
+    for (std::size_t n_bits = 1; n_bits <= 64; n_bits++) {
+      writer.Write(0x9e3779b97f4a7c15ULL * n_bits, n_bits);
+    }
+    EXPECT_EQ(writer.BitCount(), 64 * 65 / 2);
+    ByteUtils::ByteVector bytes = writer.Finish();
+    EXPECT_EQ(writer.BitCount(), 0);
+    ByteUtils::BitReader reader(bytes, order);
+    for (std::size_t n_bits = 1; n_bits <= 64; n_bits++) {
+      std::uint64_t mask = n_bits == 64 ? ~0ULL : (1ULL << n_bits) - 1;
+      ASSERT_EQ(reader.Read(n_bits), (0x9e3779b97f4a7c15ULL * n_bits) & mask);
+    }
+  }
+}
+
+TEST(TestBitStream, TestWriteMsbFirst) {
+  ByteUtils::BitWriter writer;
+  writer.Write(0x4, 4);
+  writer.Write(0x14, 12);
+  writer.Write(0x1, 1);
+  std::string output = writer.Finish().ToHex();
+  std::string expected_output = "401480";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
\ No newline at end of file
@@ -126,4 +126,11 @@ TEST(TestByte, TestReverseIterator) {
   std::string output = ::testing::internal::GetCapturedStdout();
   std::string  expected_output = "10101010";
   ASSERT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestByte, TestReverseBits) {
+  ByteUtils::Byte byte("10110000", 2);
+  EXPECT_STREQ(ByteUtils::ReverseBits(byte).ToHex().c_str(), "0d");
+  byte.ReverseBits();
+  EXPECT_STREQ(byte.ToHex().c_str(), "0d");
 }
\ No newline at end of file
@@ -0,0 +1,90 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "../include/byte_expression.h"
+#include "../include/byte_vector.h"
+#include "../include/word.h"
+#include "allocation_counter.h"
+
+TEST(TestByteExpression, TestByteVectorExpression) {
+  ByteUtils::ByteVector a("f0f0aa");
+  ByteUtils::ByteVector b("ff0055");
+  ByteUtils::ByteVector c("0f0f0f");
+  ByteUtils::ByteVector result = (ByteUtils::Lazy(a) ^ b) & ~ByteUtils::Lazy(c);
+  std::string output = result.ToHex();
+  std::string expected_output = ((a ^ b) & ~c).ToHex();
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestByteExpression, TestShiftExpression) {
+  ByteUtils::ByteVector bytes("0180ff");
+  ByteUtils::ByteVector left = ByteUtils::Lazy(bytes) << 9;
+  ByteUtils::ByteVector right = ByteUtils::Lazy(bytes) >> 4;
+  EXPECT_STREQ(left.ToHex().c_str(), "01fe00");
+  EXPECT_STREQ(right.ToHex().c_str(), "00180f");
+  EXPECT_THROW(ByteUtils::Lazy(bytes) << 25, std::out_of_range);
+}
+
+TEST(TestByteExpression, TestWordExpression) {
+  ByteUtils::Word a("0f0f0f0f");
+  ByteUtils::Word b("ff00ff00");
+  ByteUtils::Word c("ffff0000");
+  ByteUtils::Word result = ~(ByteUtils::Lazy(a) ^ (b & c)) >> 4;
+  std::string output = result.ToHex();
+  std::string expected_output = (~(a ^ (b & c)) >> 4).ToHex();
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestByteExpression, TestAssignmentToOperand) {
+  ByteUtils::ByteVector bytes("0180ff");
+  bytes = ByteUtils::Lazy(bytes) << 8 | bytes;
+  EXPECT_STREQ(bytes.ToHex().c_str(), "81ffff");
+}
+
+TEST(TestByteExpression, TestInvalidSizes) {
+  ByteUtils::ByteVector a("f0f0aa");
+  ByteUtils::ByteVector b("ff");
+  EXPECT_THROW(ByteUtils::Lazy(a) ^ b, std::runtime_error);
+}
+
+TEST(TestByteExpression, TestSingleAllocation) {
+  ByteUtils::ByteVector a("0f0f0f0f0f0f0f0f");
+  ByteUtils::ByteVector b("ff00ff00ff00ff00");
+  ByteUtils::ByteVector c("ffff0000ffff0000");
+  AllocationCounter::Reset();
+  ByteUtils::ByteVector result = ((ByteUtils::Lazy(a) ^ b) & c) | 
+                                 (ByteUtils::Lazy(a) << 8);
+  EXPECT_EQ(AllocationCounter::Count(), 1);
+  EXPECT_STREQ(result.ToHex().c_str(), "ff0f0f0fff0f0f00");
+}
+
+TEST(TestByteExpression, TestNestedShifts) {
+  ByteUtils::ByteVector bytes("0180ff0f");
+  ByteUtils::ByteVector result = 
+      ((((ByteUtils::Lazy(bytes) << 1) >> 1) << 1) >> 1) << 1;
+  std::string output = result.ToHex();
+  std::string expected_output = ((((bytes << 1) >> 1) << 1) >> 1 << 1).ToHex();
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  ByteUtils::ByteVector single = ByteUtils::Lazy(bytes) << 1;
+  EXPECT_STREQ(single.ToHex().c_str(), "0301fe1e");
+}
\ No newline at end of file
@@ -0,0 +1,110 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/byte_rope.h"
+#include "../include/byte_vector.h"
+#include "../include/shared_byte_vector.h"
+
+TEST(TestByteRope, TestAppendPrepend) {
+  ByteUtils::ByteRope rope;
+  rope.Append(ByteUtils::ByteVector("0a1b"));
+  rope.Append(ByteUtils::ByteVector());
+  rope.Prepend(ByteUtils::ByteVector("ff"));
+  rope.Append(ByteUtils::SharedByteVector(ByteUtils::ByteVector("2c3d4e")));
+  EXPECT_EQ(rope.Size(), 6);
+  EXPECT_EQ(rope.ChunkCount(), 4);
+  std::string output = rope.Flatten().ToHex();
+  std::string expected_output = "ff0a1b2c3d4e";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestByteRope, TestRandomAccess) {
+  ByteUtils::ByteRope rope;
+  rope.Append(ByteUtils::ByteVector("0a1b"));
+  EXPECT_STREQ(rope[1].ToHex().c_str(), "1b");
+  rope.Prepend(ByteUtils::ByteVector("ff"));
+  rope.Append(ByteUtils::ByteVector("2c3d"));
+  std::string output;
+  for (std::size_t index = 0; index < rope.Size(); index++) {
+    output += rope[index].ToHex();
+  }
+  std::string expected_output = "ff0a1b2c3d";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  EXPECT_THROW(rope[5], std::out_of_range);
+}
+
+TEST(TestByteRope, TestIterator) {
+  ByteUtils::ByteRope rope;
+  rope.Append(ByteUtils::ByteVector());
+  rope.Append(ByteUtils::ByteVector("0a1b"));
+  rope.Append(ByteUtils::ByteVector());
+  rope.Append(ByteUtils::ByteVector("2c"));
+  std::string output;
+  for (const auto& byte : rope) {
+    output += byte.ToHex();
+  }
+  std::string expected_output = "0a1b2c";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  ByteUtils::ByteRope empty;
+  EXPECT_FALSE(empty.begin() != empty.end());
+}
+
+TEST(TestByteRope, TestConcatenation) {
+  ByteUtils::SharedByteVector shared(ByteUtils::ByteVector("0a1b2c3d"));
+  ByteUtils::ByteRope head(shared.Slice(0, 2));
+  ByteUtils::ByteRope tail(shared.Slice(2, 2));
+  ByteUtils::ByteRope rope = tail + head;
+  rope.Prepend(rope);
+  EXPECT_STREQ(rope.Flatten().ToHex().c_str(), "2c3d0a1b2c3d0a1b");
+  EXPECT_TRUE(shared.IsShared());
+}
+
+TEST(TestByteRope, TestConcurrentRandomAccess) {
+  ByteUtils::ByteRope rope;
+  std::string expected_output;
+  for (int index = 0; index < 64; index++) {
+    ByteUtils::Byte byte(index);
+    rope.Append(ByteUtils::ByteVector(std::vector<ByteUtils::Byte>{byte}));
+    rope.Prepend(ByteUtils::ByteVector(std::vector<ByteUtils::Byte>{byte}));
+    expected_output = byte.ToHex() + expected_output + byte.ToHex();
+  }
+  rope.Prepend(ByteUtils::ByteVector());
+  const ByteUtils::ByteRope& shared = rope;
+  std::vector<std::string> outputs(4);
+  std::vector<std::thread> threads;
+  for (std::size_t thread = 0; thread < outputs.size(); thread++) {
+    threads.emplace_back([&shared, &outputs, thread]() {
+      for (std::size_t index = 0; index < shared.Size(); index++) {
+        outputs[thread] += shared[index].ToHex();
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& output : outputs) {
+    EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  }
+}
\ No newline at end of file
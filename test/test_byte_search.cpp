@@ -0,0 +1,103 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/byte_search.h"
+#include "../include/byte_vector.h"
+#include "../include/cpu_features.h"
+
+TEST(TestByteSearch, TestFindAll) {
+  ByteUtils::MultiPatternSearcher searcher({ByteUtils::ByteVector("0a1b"),
+                                            ByteUtils::ByteVector("1b2c3d"),
+                                            ByteUtils::ByteVector("2c")});
+  ByteUtils::ByteVector bytes("000a1b2c3d0a1b");
+  std::vector<ByteUtils::MultiPatternSearcher::Match> matches = 
+      searcher.FindAll(bytes);
+  ASSERT_EQ(matches.size(), 4);
+  EXPECT_EQ(matches[0].position, 1);
+  EXPECT_EQ(matches[0].pattern, 0);
+  EXPECT_EQ(matches[1].position, 3);
+  EXPECT_EQ(matches[1].pattern, 2);
+  EXPECT_EQ(matches[2].position, 2);
+  EXPECT_EQ(matches[2].pattern, 1);
+  EXPECT_EQ(matches[3].position, 5);
+  EXPECT_EQ(matches[3].pattern, 0);
+}
+
+TEST(TestByteSearch, TestNestedPatterns) {
+  ByteUtils::MultiPatternSearcher searcher({ByteUtils::ByteVector("aabbcc"),
+                                            ByteUtils::ByteVector("bbcc"),
+                                            ByteUtils::ByteVector("cc")});
+  std::vector<ByteUtils::MultiPatternSearcher::Match> matches = 
+      searcher.FindAll(ByteUtils::ByteVector("aabbcc"));
+  EXPECT_EQ(matches.size(), 3);
+  EXPECT_TRUE(searcher.ContainsAny(ByteUtils::ByteVector("00cc")));
+  EXPECT_FALSE(searcher.ContainsAny(ByteUtils::ByteVector("aabb")));
+}
+
+TEST(TestByteSearch, TestPortablePath) {
+  std::string hex;
+  for (std::size_t index = 0; index < 10000; index++) {
+    hex += ByteUtils::Byte((index * index * 7 + index) % 13).ToHex();
+  }
+  // The pattern at the end is split between two copied blocks.
+  hex.replace(2 * 4094, 8, "eeeeeeee");
+  ByteUtils::ByteVector bytes(hex);
+  // The first set starts with at most 4 distinct bytes, which the AVX2 
+  // prefilter tests; the second one doesn't.
+  std::vector<std::vector<ByteUtils::ByteVector>> pattern_sets = {
+      {ByteUtils::ByteVector("0a0b"), ByteUtils::ByteVector("0c"), 
+       ByteUtils::ByteVector("0a0507"), ByteUtils::ByteVector("eeee")},
+      {ByteUtils::ByteVector("00"), ByteUtils::ByteVector("0102"), 
+       ByteUtils::ByteVector("0203"), ByteUtils::ByteVector("0304"), 
+       ByteUtils::ByteVector("0405")}};
+  for (const auto& patterns : pattern_sets) {
+    ByteUtils::MultiPatternSearcher searcher(patterns);
+    std::vector<ByteUtils::MultiPatternSearcher::Match> matches = 
+        searcher.FindAll(bytes);
+    ByteUtils::UsePortableCodePaths(true);
+    std::vector<ByteUtils::MultiPatternSearcher::Match> portable_matches = 
+        searcher.FindAll(bytes);
+    ByteUtils::UsePortableCodePaths(false);
+    EXPECT_FALSE(matches.empty());
+    ASSERT_EQ(matches.size(), portable_matches.size());
+    for (std::size_t index = 0; index < matches.size(); index++) {
+      EXPECT_EQ(matches[index].position, portable_matches[index].position);
+      EXPECT_EQ(matches[index].pattern, portable_matches[index].pattern);
+    }
+    EXPECT_TRUE(searcher.ContainsAny(bytes));
+  }
+  ByteUtils::MultiPatternSearcher split({ByteUtils::ByteVector("eeee")});
+  std::vector<ByteUtils::MultiPatternSearcher::Match> matches = 
+      split.FindAll(bytes);
+  ASSERT_EQ(matches.size(), 3);
+  EXPECT_EQ(matches[0].position, 4094);
+  EXPECT_TRUE(split.ContainsAny(bytes));
+  EXPECT_FALSE(ByteUtils::MultiPatternSearcher(
+      {ByteUtils::ByteVector("ff")}).ContainsAny(bytes));
+}
+
+TEST(TestByteSearch, TestEmptyPattern) {
+  EXPECT_THROW(ByteUtils::MultiPatternSearcher({ByteUtils::ByteVector()}), 
+               std::invalid_argument);
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "../include/byte_stream.h"
+#include "../include/byte_vector.h"
+#include "../include/word.h"
+
+TEST(TestByteStream, TestBuilderBuild) {
+  ByteUtils::ByteVectorBuilder builder(3);
+  builder.Append(ByteUtils::Byte(0xff));
+  builder.Append(ByteUtils::Word("1a1b1c1d"));
+  builder.Append(ByteUtils::ByteVector("0a0b"));
+  const std::uint8_t raw[] = {0x01, 0x02, 0x03, 0x04};
+  builder.Append(raw, sizeof(raw));
+  ASSERT_EQ(builder.Size(), 11);
+  std::string output = builder.Build().ToHex();
+  std::string expected_output = "ff1a1b1c1d0a0b01020304";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  builder.Clear();
+  EXPECT_EQ(builder.Build().Size(), 0);
+}
+
+TEST(TestByteStream, TestBuilderWriteToStream) {
+  ByteUtils::ByteVectorBuilder builder(2);
+  builder.Append(ByteUtils::ByteVector("414243444546"));
+  std::ostringstream stream;
+  builder.WriteTo(stream);
+  EXPECT_STREQ(stream.str().c_str(), "ABCDEF");
+  std::ostringstream failed;
+  failed.setstate(std::ios::badbit);
+  EXPECT_THROW(builder.WriteTo(failed), std::runtime_error);
+}
+
+TEST(TestByteStream, TestBuilderWriteToFileDescriptor) {
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  ByteUtils::ByteVectorBuilder builder(4);
+  builder.Append(ByteUtils::ByteVector("48656c6c6f2c20776f726c64"));
+  builder.WriteTo(fds[1]);
+  close(fds[1]);
+  ByteUtils::ByteVectorReader reader(fds[0], 5);
+  ByteUtils::ByteVector chunk;
+  std::string output;
+  while (reader.Next(chunk)) {
+    output += chunk.ToHex() + ";";
+  }
+  close(fds[0]);
+  std::string expected_output = "48656c6c6f;2c20776f72;6c64;";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestByteStream, TestReaderStream) {
+  std::istringstream stream("ABCDE");
+  ByteUtils::ByteVectorReader reader(stream, 2);
+  ByteUtils::ByteVector chunk;
+  std::string output;
+  while (reader.Next(chunk)) {
+    output += chunk.ToHex() + ";";
+  }
+  std::string expected_output = "4142;4344;45;";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
\ No newline at end of file
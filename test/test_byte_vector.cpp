@@ -18,12 +18,16 @@
 */
 #include <gtest/gtest.h>
 
+#include <array>
 #include <iostream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
 #include "../include/byte_vector.h"
+#include "../include/cpu_features.h"
 #include "../include/word.h"
+#include "allocation_counter.h"
 
 TEST(TestByteVector, TestConstructor) {
   ByteUtils::ByteVector bytes("0a1b");
@@ -132,4 +136,196 @@ TEST(TestByteVector, TestConstReverseIterator) {
   std::string output = ::testing::internal::GetCapturedStdout();
   std::string expected_output = "1b0a";
   ASSERT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestByteVector, TestBitwiseOperators) {
+  ByteUtils::ByteVector bytes1("f0f0aa");
+  ByteUtils::ByteVector bytes2("ff0055");
+  EXPECT_STREQ((bytes1 ^ bytes2).ToHex().c_str(), "0ff0ff");
+  EXPECT_STREQ((bytes1 & bytes2).ToHex().c_str(), "f00000");
+  EXPECT_STREQ((bytes1 | bytes2).ToHex().c_str(), "fff0ff");
+  EXPECT_STREQ((~bytes1).ToHex().c_str(), "0f0f55");
+  EXPECT_THROW(bytes1 ^ ByteUtils::ByteVector("ff"), std::runtime_error);
+}
+
+TEST(TestByteVector, TestShiftOperators) {
+  ByteUtils::ByteVector bytes("0180ff");
+  EXPECT_STREQ((bytes << 9).ToHex().c_str(), "01fe00");
+  EXPECT_STREQ((bytes >> 4).ToHex().c_str(), "00180f");
+  bytes <<= 24;
+  EXPECT_STREQ(bytes.ToHex().c_str(), "000000");
+  EXPECT_THROW(bytes >>= 25, std::out_of_range);
+}
+
+TEST(TestByteVector, TestRvalueChainAllocatesOnce) {
+  ByteUtils::ByteVector a("0f0f0f0f0f0f0f0f");
+  ByteUtils::ByteVector b("ff00ff00ff00ff00");
+  ByteUtils::ByteVector c("ffff0000ffff0000");
+  AllocationCounter::Reset();
+  ByteUtils::ByteVector result = ((a ^ b) & c) | (a << 8);
+  std::size_t allocations = AllocationCounter::Count();
+  // The shifted copy of `a` is the second operand and needs its own storage.
+  EXPECT_LE(allocations, 2);
+  AllocationCounter::Reset();
+  result = ~(a ^ b) ^ c;
+  EXPECT_LE(AllocationCounter::Count(), 1);
+  EXPECT_STREQ(result.ToHex().c_str(), "f00f0ff0f00f0ff0");
+}
+
+TEST(TestByteVector, TestToBase64) {
+  ByteUtils::ByteVector bytes("666f6f626172");
+  EXPECT_STREQ(bytes.ToBase64().c_str(), "Zm9vYmFy");
+  ByteUtils::ByteVector bytes2("666f6f6261");
+  EXPECT_STREQ(bytes2.ToBase64().c_str(), "Zm9vYmE=");
+  EXPECT_STREQ(bytes2.ToBase64(ByteUtils::Base64Alphabet::kStandard, 
+                               false).c_str(), "Zm9vYmE");
+  ByteUtils::ByteVector bytes3("fbff");
+  EXPECT_STREQ(bytes3.ToBase64().c_str(), "+/8=");
+  EXPECT_STREQ(bytes3.ToBase64(ByteUtils::Base64Alphabet::kUrlSafe, 
+                               false).c_str(), "-_8");
+}
+
+TEST(TestByteVector, TestFromBase64) {
+  std::string output = ByteUtils::ByteVector::FromBase64("Zm9vYg==").ToHex();
+  EXPECT_STREQ(output.c_str(), "666f6f62");
+  output = ByteUtils::ByteVector::FromBase64("Zm9vYg").ToHex();
+  EXPECT_STREQ(output.c_str(), "666f6f62");
+  output = ByteUtils::ByteVector::FromBase64(
+      "-_8", ByteUtils::Base64Alphabet::kUrlSafe).ToHex();
+  EXPECT_STREQ(output.c_str(), "fbff");
+  EXPECT_EQ(ByteUtils::ByteVector::FromBase64("").Size(), 0);
+}
+
+TEST(TestByteVector, TestFromBase64Invalid) {
+  using ByteUtils::ByteVector;
+  EXPECT_THROW(ByteVector::FromBase64("Zm9vY"), std::invalid_argument);
+  EXPECT_THROW(ByteVector::FromBase64("Zm9vYg="), std::invalid_argument);
+  EXPECT_THROW(ByteVector::FromBase64("Zm=vYg=="), std::invalid_argument);
+  EXPECT_THROW(ByteVector::FromBase64("Zm9vYh=="), std::invalid_argument);
+  EXPECT_THROW(ByteVector::FromBase64("-_8"), std::invalid_argument);
+}
+
+TEST(TestByteVector, TestBase64PortablePath) {
+  using ByteUtils::Base64Alphabet;
+  using ByteUtils::ByteVector;
+  // The sizes cover the 12-byte steps of the SSSE3 path, its tails and 
+  // the groups split between two copied blocks.
+  for (std::size_t size : {0, 1, 2, 12, 13, 16, 17, 29, 4095, 4096, 10000}) {
+    std::string hex;
+    for (std::size_t index = 0; index < size; index++) {
+      hex += ByteUtils::Byte((index * 131 + 7) & 0xff).ToHex();
+    }
+    ByteVector bytes(hex);
+    for (auto alphabet : {Base64Alphabet::kStandard, 
+                          Base64Alphabet::kUrlSafe}) {
+      std::string base64 = bytes.ToBase64(alphabet);
+      std::string unpadded = bytes.ToBase64(alphabet, false);
+      ByteVector decoded = ByteVector::FromBase64(base64, alphabet);
+      ByteUtils::UsePortableCodePaths(true);
+      std::string portable_base64 = bytes.ToBase64(alphabet);
+      std::string portable_unpadded = bytes.ToBase64(alphabet, false);
+      ByteVector portable_decoded = ByteVector::FromBase64(base64, alphabet);
+      ByteUtils::UsePortableCodePaths(false);
+      EXPECT_EQ(base64, portable_base64);
+      EXPECT_EQ(unpadded, portable_unpadded);
+      EXPECT_STREQ(decoded.ToHex().c_str(), hex.c_str());
+      EXPECT_STREQ(portable_decoded.ToHex().c_str(), hex.c_str());
+    }
+  }
+  std::string invalid(40, 'A');
+  invalid[21] = '*';
+  try {
+    ByteVector::FromBase64(invalid);
+    FAIL();
+  } catch (const std::invalid_argument& error) {
+    EXPECT_STREQ(error.what(), "Invalid Base64 character at position 21.");
+  }
+}
+
+TEST(TestByteVector, TestFindByte) {
+  ByteUtils::ByteVector bytes("0a1b0a2c");
+  EXPECT_EQ(bytes.Find(ByteUtils::Byte(0x0a)), 0);
+  EXPECT_EQ(bytes.Find(ByteUtils::Byte(0x0a), 1), 2);
+  EXPECT_EQ(bytes.Find(ByteUtils::Byte(0xff)), ByteUtils::ByteVector::kNotFound);
+  EXPECT_EQ(bytes.Count(ByteUtils::Byte(0x0a)), 2);
+}
+
+TEST(TestByteVector, TestFindNeedle) {
+  ByteUtils::ByteVector bytes("0d0a0d0a0d0a00");
+  ByteUtils::ByteVector needle("0a0d0a");
+  EXPECT_EQ(bytes.Find(needle), 1);
+  EXPECT_EQ(bytes.Find(needle, 2), 3);
+  EXPECT_EQ(bytes.Find(needle, 4), ByteUtils::ByteVector::kNotFound);
+  EXPECT_EQ(bytes.Find(ByteUtils::ByteVector("ff")), 
+            ByteUtils::ByteVector::kNotFound);
+  EXPECT_EQ(bytes.Find(ByteUtils::ByteVector(), 3), 3);
+  EXPECT_EQ(bytes.Find(ByteUtils::ByteVector("00")), 6);
+  std::vector<std::size_t> positions = bytes.FindAll(needle);
+  ASSERT_EQ(positions.size(), 2);
+  EXPECT_EQ(positions[0], 1);
+  EXPECT_EQ(positions[1], 3);
+  EXPECT_EQ(bytes.Count(ByteUtils::ByteVector("0d0a")), 3);
+}
+
+TEST(TestByteVector, TestFindPortablePath) {
+  std::string hex;
+  for (std::size_t index = 0; index < 9000; index++) {
+    hex += ByteUtils::Byte((index * index * 7 + index) % 11).ToHex();
+  }
+  ByteUtils::ByteVector bytes(hex);
+  // The needles of every short length match across the blocks gathered 
+  // by the AVX2 path, which start at 64 bytes and grow to 4096.
+  for (std::size_t size = 1; size <= 8; size++) {
+    for (std::size_t from : {0, 60, 4090, 8990}) {
+      ByteUtils::ByteVector needle(hex.substr(2 * from, 2 * size));
+      std::vector<std::size_t> positions = bytes.FindAll(needle);
+      std::size_t next = bytes.Find(needle, from + 1);
+      ByteUtils::UsePortableCodePaths(true);
+      std::vector<std::size_t> portable_positions = bytes.FindAll(needle);
+      std::size_t portable_next = bytes.Find(needle, from + 1);
+      ByteUtils::UsePortableCodePaths(false);
+      EXPECT_FALSE(positions.empty());
+      EXPECT_EQ(positions, portable_positions);
+      EXPECT_EQ(next, portable_next);
+    }
+  }
+  EXPECT_EQ(bytes.Find(ByteUtils::ByteVector("0b")), 
+            ByteUtils::ByteVector::kNotFound);
+}
+
+TEST(TestByteVector, TestFindLongNeedle) {
+  std::string hex;
+  for (int index = 0; index < 100; index++) {
+    hex += "00010203040506070809";
+  }
+  ByteUtils::ByteVector bytes(hex + "ffeeddccbbaa99887766554433" + hex);
+  ByteUtils::ByteVector needle("0809ffeeddccbbaa99887766554433");
+  EXPECT_EQ(bytes.Find(needle), 998);
+  ByteUtils::ByteVector repeated("000102030405060708090001");
+  EXPECT_EQ(bytes.Count(repeated), 198);
+  EXPECT_EQ(bytes.Find(repeated, 990), 1013);
+}
+
+TEST(TestByteVector, TestSubstitute) {
+  std::array<ByteUtils::Byte, 256> table;
+  for (int value = 0; value < 256; value++) {
+    table[value] = ByteUtils::Byte(255 - value);
+  }
+  ByteUtils::ByteVector bytes("00017f80ff");
+  bytes.Substitute(table);
+  std::string output = bytes.ToHex();
+  std::string expected_output = "fffe807f00";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestByteVector, TestReverse) {
+  ByteUtils::ByteVector bytes("0f1e2d3c4b");
+  std::string output = ByteUtils::ReverseBits(bytes).ToHex();
+  std::string expected_output = "f078b43cd2";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  bytes.ReverseBytes();
+  bytes.ReverseBits();
+  output = bytes.ToHex();
+  expected_output = "d23cb478f0";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
 }
\ No newline at end of file
@@ -0,0 +1,93 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/byte_vector.h"
+#include "../include/chacha20.h"
+#include "../include/word.h"
+
+namespace {
+
+const ByteUtils::Word kKey(
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f", 256);
+
+}  // namespace
+
+TEST(TestChaCha20, TestBlockFunction) {
+  // RFC 8439, section 2.3.2.
+  ByteUtils::ChaCha20 cipher(kKey, 
+                             ByteUtils::Word("000000090000004a00000000", 96), 
+                             1);
+  std::string output = cipher.Keystream(64).ToHex();
+  std::string expected_output = 
+      "10f1e7e4d13b5915500fdd1fa32071c4c7d1f4c733c068030422aa9ac3d46c4e"
+      "d2826446079faa0914c2d705d98b02a2b5129cd1de164eb9cbd083e8a2503c4e";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestChaCha20, TestEncryption) {
+  // RFC 8439, section 2.4.2.
+  std::string text = "Ladies and Gentlemen of the class of '99: If I could "
+                     "offer you only one tip for the future, sunscreen would "
+                     "be it.";
+  ByteUtils::ByteVector bytes(std::vector<ByteUtils::Byte>(text.begin(), 
+                                                           text.end()));
+  ByteUtils::Word nonce("000000000000004a00000000", 96);
+  ByteUtils::ChaCha20 cipher(kKey, nonce, 1);
+  cipher.Apply(bytes);
+  std::string output = bytes.ToHex();
+  std::string expected_output = 
+      "6e2e359a2568f98041ba0728dd0d6981e97e7aec1d4360c20a27afccfd9fae0b"
+      "f91b65c5524733ab8f593dabcd62b3571639d624e65152ab8f530c359f0861d8"
+      "07ca0dbf500d6a6156a38e088a22b65e52bc514d16ccf806818ce91ab7793736"
+      "5af90bbf74a35be6b40b8eedf2785e42874d";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  ByteUtils::ChaCha20 decipher(kKey, nonce, 1);
+  decipher.Apply(bytes);
+  EXPECT_STREQ(bytes.ToHex().c_str(), 
+               ByteUtils::ByteVector(std::vector<ByteUtils::Byte>(
+                   text.begin(), text.end())).ToHex().c_str());
+}
+
+TEST(TestChaCha20, TestContinuation) {
+  ByteUtils::Word nonce("000000000000004a00000000", 96);
+  ByteUtils::ChaCha20 whole(kKey, nonce);
+  ByteUtils::ChaCha20 pieces(kKey, nonce);
+  std::string expected_output = whole.Keystream(1500).ToHex();
+  std::string output;
+  for (std::size_t size : {1, 63, 64, 500, 872}) {
+    output += pieces.Keystream(size).ToHex();
+  }
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestChaCha20, TestInvalidArguments) {
+  ByteUtils::Word nonce("000000000000004a00000000", 96);
+  EXPECT_THROW(ByteUtils::ChaCha20(ByteUtils::Word("00", 128), nonce), 
+               std::invalid_argument);
+  EXPECT_THROW(ByteUtils::ChaCha20(kKey, ByteUtils::Word("00", 64)), 
+               std::invalid_argument);
+  ByteUtils::ChaCha20 cipher(kKey, nonce, 0xfffffffe);
+  EXPECT_NO_THROW(cipher.Keystream(128));
+  EXPECT_THROW(cipher.Keystream(1), std::runtime_error);
+}
\ No newline at end of file
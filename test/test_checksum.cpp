@@ -0,0 +1,88 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "../include/byte_vector.h"
+#include "../include/checksum.h"
+#include "../include/cpu_features.h"
+
+TEST(TestChecksum, TestCrc32CheckValue) {
+  // The standard check value is the checksum of the ASCII "123456789".
+  ByteUtils::ByteVector bytes("313233343536373839");
+  EXPECT_EQ(ByteUtils::Crc32::Compute(bytes), 0xcbf43926);
+  EXPECT_EQ(ByteUtils::Crc32::Compute(ByteUtils::ByteVector()), 0);
+}
+
+TEST(TestChecksum, TestCrc32cCheckValue) {
+  ByteUtils::ByteVector bytes("313233343536373839");
+  EXPECT_EQ(ByteUtils::Crc32c::Compute(bytes), 0xe3069283);
+  ByteUtils::ByteVector zeros(std::string(64, '0'));
+  EXPECT_EQ(ByteUtils::Crc32c::Compute(zeros), 0x8a9136aa);
+}
+
+TEST(TestChecksum, TestIncrementalUpdate) {
+  ByteUtils::Crc32 crc32;
+  ByteUtils::Crc32c crc32c;
+  crc32.Update(ByteUtils::ByteVector("3132"));
+  crc32c.Update(ByteUtils::ByteVector("3132"));
+  crc32.Update(ByteUtils::Byte(0x33));
+  crc32c.Update(ByteUtils::Byte(0x33));
+  const std::uint8_t raw[] = {'4', '5', '6', '7', '8', '9'};
+  crc32.Update(raw, sizeof(raw));
+  crc32c.Update(raw, sizeof(raw));
+  EXPECT_EQ(crc32.Value(), 0xcbf43926);
+  EXPECT_EQ(crc32c.Value(), 0xe3069283);
+  crc32.Reset();
+  EXPECT_EQ(crc32.Value(), 0);
+}
+
+TEST(TestChecksum, TestLargeInput) {
+  // Crosses the internal block size and the 8-byte fast path.
+  std::string hex;
+  for (int index = 0; index < 5000; index++) {
+    hex += "a5";
+  }
+  ByteUtils::ByteVector bytes(hex);
+  ByteUtils::Crc32c whole;
+  whole.Update(bytes);
+  ByteUtils::Crc32c bytewise;
+  for (const auto& byte : bytes) {
+    bytewise.Update(byte);
+  }
+  EXPECT_EQ(whole.Value(), bytewise.Value());
+  EXPECT_EQ(whole.Value(), 0x3fe75715);
+}
+
+TEST(TestChecksum, TestPortableCrc32c) {
+  std::string hex;
+  for (int index = 0; index < 5000; index++) {
+    hex += "a5";
+  }
+  ByteUtils::ByteVector bytes(hex);
+  ByteUtils::UsePortableCodePaths(true);
+  std::uint32_t large = ByteUtils::Crc32c::Compute(bytes);
+  std::uint32_t check = ByteUtils::Crc32c::Compute(
+      ByteUtils::ByteVector("313233343536373839"));
+  ByteUtils::UsePortableCodePaths(false);
+  EXPECT_EQ(large, 0x3fe75715);
+  EXPECT_EQ(check, 0xe3069283);
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "../include/byte_vector.h"
+#include "../include/hash.h"
+#include "../include/word.h"
+
+TEST(TestHash, TestComparisonOperators) {
+  ByteUtils::ByteVector bytes1("0a1b");
+  ByteUtils::ByteVector bytes2("0a1c");
+  EXPECT_TRUE(bytes1 == ByteUtils::ByteVector("0a1b"));
+  EXPECT_TRUE(bytes1 != bytes2);
+  EXPECT_TRUE(bytes1 < bytes2);
+  EXPECT_TRUE(ByteUtils::ByteVector("0a") < bytes1);
+  EXPECT_FALSE(bytes2 < bytes1);
+  EXPECT_TRUE(ByteUtils::Word("ff") == ByteUtils::Word("000000ff"));
+  EXPECT_TRUE(ByteUtils::Word("ff") < ByteUtils::Word("0100"));
+  EXPECT_TRUE(ByteUtils::Byte(0x7f) < ByteUtils::Byte(0x80));
+}
+
+TEST(TestHash, TestHashIsDeterministic) {
+  std::string hex;
+  for (int index = 0; index < 300; index++) {
+    hex += "5a";
+  }
+  for (std::size_t size : {0, 1, 3, 4, 8, 16, 17, 48, 49, 100, 300}) {
+    ByteUtils::ByteVector bytes1(hex.substr(0, size * 2));
+    ByteUtils::ByteVector bytes2(hex.substr(0, size * 2));
+    EXPECT_EQ(ByteUtils::Hash64(bytes1), ByteUtils::Hash64(bytes2));
+    EXPECT_NE(ByteUtils::Hash64(bytes1), ByteUtils::Hash64(bytes1, 1));
+  }
+}
+
+TEST(TestHash, TestHashDistinguishesInputs) {
+  // Every 1 and 2 byte input gets a different hash.
+  std::unordered_set<std::uint64_t> hashes;
+  for (int value = 0; value < 256; value++) {
+    std::uint8_t data[2] = {static_cast<std::uint8_t>(value), 0};
+    hashes.insert(ByteUtils::Hash64(data, 1));
+    hashes.insert(ByteUtils::Hash64(data, 2));
+  }
+  EXPECT_EQ(hashes.size(), 512);
+}
+
+TEST(TestHash, TestStdHashSpecializations) {
+  std::unordered_map<ByteUtils::ByteVector, int> map;
+  map[ByteUtils::ByteVector("0a1b")] = 1;
+  map[ByteUtils::ByteVector("0a1c")] = 2;
+  map[ByteUtils::ByteVector("0a1b")] += 10;
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map[ByteUtils::ByteVector("0a1b")], 11);
+  std::unordered_set<ByteUtils::Word> words;
+  words.insert(ByteUtils::Word("1a1b1c1d"));
+  words.insert(ByteUtils::Word("1a1b1c1d"));
+  EXPECT_EQ(words.size(), 1);
+  std::set<ByteUtils::ByteVector> ordered = {ByteUtils::ByteVector("ff"), 
+                                             ByteUtils::ByteVector("00")};
+  EXPECT_STREQ(ordered.begin()->ToHex().c_str(), "00");
+}
+
+TEST(TestHash, TestHashedByteVector) {
+  ByteUtils::HashedByteVector key(ByteUtils::ByteVector("0a1b"));
+  EXPECT_EQ(key.Hash(), ByteUtils::Hash64(ByteUtils::ByteVector("0a1b")));
+  std::unordered_set<ByteUtils::HashedByteVector> keys;
+  keys.insert(key);
+  keys.emplace(ByteUtils::ByteVector("0a1b"));
+  keys.emplace(ByteUtils::ByteVector("0a1c"));
+  EXPECT_EQ(keys.size(), 2);
+}
\ No newline at end of file
@@ -0,0 +1,86 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/hex_batch.h"
+#include "../include/byte_vector.h"
+#include "allocation_counter.h"
+
+TEST(TestHexBatch, TestParseText) {
+  ByteUtils::HexBatch batch = 
+      ByteUtils::HexBatch::Parse("0a1b2c\r\nabc\n\nzz11\nFFee\n");
+  ASSERT_EQ(batch.Size(), 5);
+  EXPECT_STREQ(batch[0].ToHex().c_str(), "0a1b2c");
+  EXPECT_STREQ(batch[1].ToHex().c_str(), "0abc");
+  EXPECT_EQ(batch[2].Size(), 0);
+  EXPECT_EQ(batch[3].Size(), 0);
+  EXPECT_STREQ(batch[4].ToHex().c_str(), "ffee");
+  EXPECT_EQ(batch.Arena().Size(), 7);
+  ASSERT_EQ(batch.Errors().size(), 1);
+  EXPECT_EQ(batch.Errors()[0].line, 3);
+  std::string output = batch.Errors()[0].message;
+  std::string expected_output = 
+      "Invalid hexadecimal character 'z' at column 0.";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  EXPECT_THROW(batch[5], std::out_of_range);
+}
+
+TEST(TestHexBatch, TestParseParallel) {
+  std::vector<std::string> lines;
+  for (int i = 0; i < 50000; i++) {
+    lines.push_back(i % 1000 == 999 ? "x" : ByteUtils::Byte(i).ToHex() + 
+                                            ByteUtils::Byte(i >> 8).ToHex());
+  }
+  ByteUtils::HexBatch batch = ByteUtils::HexBatch::Parse(lines, 8);
+  ASSERT_EQ(batch.Size(), lines.size());
+  ASSERT_EQ(batch.Errors().size(), 50);
+  for (std::size_t i = 0; i < batch.Errors().size(); i++) {
+    ASSERT_EQ(batch.Errors()[i].line, i * 1000 + 999);
+  }
+  for (std::size_t i = 0; i < lines.size(); i++) {
+    if (i % 1000 != 999) {
+      ASSERT_STREQ(batch[i].ToHex().c_str(), lines[i].c_str());
+    }
+  }
+}
+
+TEST(TestHexBatch, TestFailedAllocation) {
+  std::vector<std::string> lines(4 * 4096, "0a1b");
+  // Fails every allocation in turn, including those that start the 
+  // threads, until the parsing succeeds.
+  for (std::size_t allocation = 1;; allocation++) {
+    AllocationCounter::Reset();
+    AllocationCounter::FailAt(allocation);
+    try {
+      ByteUtils::HexBatch batch = ByteUtils::HexBatch::Parse(lines, 4);
+      AllocationCounter::FailAt(0);
+      ASSERT_EQ(batch.Size(), lines.size());
+      EXPECT_STREQ(batch[lines.size() - 1].ToHex().c_str(), "0a1b");
+      EXPECT_GT(allocation, 1);
+      break;
+    } catch (const std::bad_alloc&) {
+    }
+  }
+  AllocationCounter::FailAt(0);
+}
\ No newline at end of file
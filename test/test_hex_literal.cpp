@@ -0,0 +1,56 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+#include "../include/byte_vector.h"
+#include "../include/hex_literal.h"
+#include "../include/word.h"
+
+using namespace ByteUtils::Literals;
+
+TEST(TestHexLiteral, TestByte) {
+  constexpr ByteUtils::Byte byte = "2b"_byte;
+  EXPECT_STREQ(byte.ToHex().c_str(), "2b");
+  EXPECT_STREQ(("F"_byte).ToHex().c_str(), "0f");
+}
+
+TEST(TestHexLiteral, TestWordAndBytes) {
+  constexpr auto kWord = "2b7e1516"_word;
+  static_assert(kWord.Size() == 4, "The word literal must have 4 bytes.");
+  ByteUtils::Word word = kWord;
+  EXPECT_STREQ(word.ToHex().c_str(), "2b7e1516");
+  constexpr auto kBytes = "abcdeF0"_bytes;
+  static_assert(kBytes.Size() == 4, "The odd literal must have 4 bytes.");
+  ByteUtils::ByteVector bytes = kBytes;
+  std::string output = bytes.ToHex();
+  std::string expected_output = "0abcdef0";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestHexLiteral, TestMalformed) {
+  EXPECT_THROW(ByteUtils::HexLiteral<ByteUtils::ByteVector>("0g", 2), 
+               std::invalid_argument);
+  EXPECT_THROW(ByteUtils::HexLiteral<ByteUtils::ByteVector>(
+                   std::string(258, '0').c_str(), 258), 
+               std::invalid_argument);
+  EXPECT_THROW("123"_byte, std::invalid_argument);
+}
\ No newline at end of file
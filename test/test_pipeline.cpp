@@ -0,0 +1,99 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+
+#include "../include/byte_vector.h"
+#include "../include/checksum.h"
+#include "../include/pipeline.h"
+
+namespace {
+
+// Returns a source of `count` chunks of 4 bytes holding their index.
+ByteUtils::Pipeline::Source CountingSource(int count, 
+                                           std::atomic<int>& produced) {
+  return [count, &produced](ByteUtils::ByteVector& chunk) {
+    if (produced == count) {
+      return false;
+    }
+    std::string hex;
+    for (int i = 0; i < 4; i++) {
+      hex += ByteUtils::Byte(produced.load()).ToHex();
+    }
+    chunk = ByteUtils::ByteVector(hex);
+    produced++;
+    return true;
+  };
+}
+
+}  // namespace
+
+TEST(TestPipeline, TestStages) {
+  for (bool own_thread : {false, true}) {
+    std::atomic<int> produced(0);
+    ByteUtils::Crc32c crc;
+    std::string output;
+    ByteUtils::Pipeline(CountingSource(3, produced))
+        .Then([](ByteUtils::ByteVector& chunk) { 
+          chunk ^= ByteUtils::ByteVector("ff00ff00"); 
+        }, own_thread)
+        .Then([&crc](ByteUtils::ByteVector& chunk) { crc.Update(chunk); })
+        .Then([](ByteUtils::ByteVector& chunk) { chunk >>= 4; }, own_thread)
+        .Run([&output](const ByteUtils::ByteVector& chunk) { 
+          output += chunk.ToHex(); 
+        });
+    std::string expected_output = "0ff00ff0" "0fe01fe0" "0fd02fd0";
+    EXPECT_STREQ(output.c_str(), expected_output.c_str());
+    EXPECT_EQ(crc.Value(), ByteUtils::Crc32c::Compute(
+        ByteUtils::ByteVector("ff00ff00fe01fe01fd02fd02")));
+  }
+}
+
+TEST(TestPipeline, TestBackpressure) {
+  std::atomic<int> produced(0);
+  int consumed = 0;
+  int max_in_flight = 0;
+  ByteUtils::Pipeline(CountingSource(200, produced), 2)
+      .Then([](ByteUtils::ByteVector&) {}, true)
+      .Run([&](const ByteUtils::ByteVector&) {
+        consumed++;
+        max_in_flight = std::max(max_in_flight, produced - consumed);
+      });
+  EXPECT_EQ(consumed, 200);
+  // A chunk in each stage and a full queue between them.
+  EXPECT_LE(max_in_flight, 4);
+}
+
+TEST(TestPipeline, TestError) {
+  std::atomic<int> produced(0);
+  ByteUtils::Pipeline pipeline(CountingSource(1000, produced), 1);
+  pipeline.Then([](ByteUtils::ByteVector& chunk) {
+    if (chunk[0].ToInt() == 5) {
+      throw std::runtime_error("Stage failed.");
+    }
+  }, true);
+  pipeline.Then([](ByteUtils::ByteVector&) {}, true);
+  EXPECT_THROW(pipeline.Run([](const ByteUtils::ByteVector&) {}), 
+               std::runtime_error);
+  EXPECT_LT(produced, 1000);
+}
\ No newline at end of file
@@ -0,0 +1,136 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../include/byte_vector.h"
+#include "../include/radix_sort.h"
+#include "allocation_counter.h"
+
+namespace {
+
+// Returns `count` keys of 0 to 40 bytes with many shared prefixes 
+// and duplicates.
+std::vector<ByteUtils::ByteVector> RandomKeys(std::size_t count) {
+  std::vector<ByteUtils::ByteVector> keys;
+  std::uint64_t state = 0x9e3779b97f4a7c15;
+  for (std::size_t i = 0; i < count; i++) {
+    state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+    std::vector<ByteUtils::Byte> bytes(state % 5, ByteUtils::Byte(0xaa));
+    for (std::size_t byte = 0; byte < (state >> 8) % 36; byte++) {
+      bytes.emplace_back(static_cast<std::uint8_t>(state >> (byte % 7 * 8)));
+    }
+    keys.emplace_back(std::move(bytes));
+  }
+  return keys;
+}
+
+}  // namespace
+
+TEST(TestRadixSort, TestSmall) {
+  std::vector<ByteUtils::ByteVector> keys = {
+    ByteUtils::ByteVector("0a1b"), ByteUtils::ByteVector("0a"), 
+    ByteUtils::ByteVector(), ByteUtils::ByteVector("ff"), 
+    ByteUtils::ByteVector("0a1a")
+  };
+  ByteUtils::RadixSort(keys);
+  std::string output;
+  for (const auto& key : keys) {
+    output += key.ToHex() + ",";
+  }
+  std::string expected_output = ",0a,0a1a,0a1b,ff,";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestRadixSort, TestMatchesSort) {
+  std::vector<ByteUtils::ByteVector> keys = RandomKeys(20000);
+  std::vector<ByteUtils::ByteVector> expected = keys;
+  std::sort(expected.begin(), expected.end());
+  ByteUtils::RadixSort(keys);
+  EXPECT_TRUE(keys == expected);
+}
+
+TEST(TestRadixSort, TestParallel) {
+  std::vector<ByteUtils::ByteVector> keys = RandomKeys(100000);
+  std::vector<ByteUtils::ByteVector> expected = keys;
+  std::sort(expected.begin(), expected.end());
+  ByteUtils::ParallelRadixSort(keys, 4);
+  EXPECT_TRUE(keys == expected);
+}
+
+TEST(TestRadixSort, TestParallelTasks) {
+  // Four keys in five start with `aa`, so the first byte alone can't 
+  // spread them.
+  std::vector<ByteUtils::ByteVector> keys = RandomKeys(100000);
+  std::vector<std::size_t> tasks = ByteUtils::Internal::ParallelSortTasks(
+      keys, 4);
+  std::size_t total = 0;
+  for (const auto& task : tasks) {
+    total += task;
+  }
+  EXPECT_LE(total, keys.size());
+  EXPECT_GE(tasks.size(), 4 * 8);
+  EXPECT_LE(tasks.front(), keys.size() / (4 * 8));
+  EXPECT_TRUE(std::is_sorted(tasks.rbegin(), tasks.rend()));
+}
+
+TEST(TestRadixSort, TestParallelCommonPrefix) {
+  std::vector<ByteUtils::ByteVector> keys = RandomKeys(70000);
+  // Every key starts with the same 16 bytes.
+  for (auto& key : keys) {
+    std::vector<ByteUtils::Byte> bytes(16, ByteUtils::Byte(0xee));
+    bytes.insert(bytes.end(), key.Data(), key.Data() + key.Size());
+    key = ByteUtils::ByteVector(std::move(bytes));
+  }
+  std::vector<ByteUtils::ByteVector> expected = keys;
+  std::sort(expected.begin(), expected.end());
+  ByteUtils::ParallelRadixSort(keys, 4);
+  EXPECT_TRUE(keys == expected);
+}
+
+TEST(TestRadixSort, TestFailedAllocation) {
+  const std::vector<ByteUtils::ByteVector> keys = RandomKeys(1 << 16);
+  std::vector<ByteUtils::ByteVector> expected = keys;
+  std::sort(expected.begin(), expected.end());
+  std::vector<ByteUtils::ByteVector> sorted = keys;
+  AllocationCounter::Reset();
+  ByteUtils::ParallelRadixSort(sorted, 4);
+  const std::size_t allocations = AllocationCounter::Count();
+  // Fails every allocation in turn, including those that start the 
+  // threads; the sort either completes or leaves the keys unchanged.
+  for (std::size_t allocation = 1; allocation <= allocations; allocation++) {
+    sorted = keys;
+    AllocationCounter::Reset();
+    AllocationCounter::FailAt(allocation);
+    try {
+      ByteUtils::ParallelRadixSort(sorted, 4);
+      AllocationCounter::FailAt(0);
+      ASSERT_TRUE(sorted == expected);
+    } catch (const std::bad_alloc&) {
+      AllocationCounter::FailAt(0);
+      ASSERT_TRUE(sorted == keys);
+    }
+  }
+}
\ No newline at end of file
@@ -0,0 +1,109 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "../include/byte_vector.h"
+#include "../include/rank_select.h"
+
+namespace {
+
+// Returns a bitmap of `size` bytes, mostly empty with dense runs.
+ByteUtils::ByteVector RandomBitmap(std::size_t size) {
+  std::vector<ByteUtils::Byte> bytes;
+  std::uint64_t state = 0x9e3779b97f4a7c15;
+  for (std::size_t i = 0; i < size; i++) {
+    state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+    bytes.emplace_back(static_cast<std::uint8_t>(
+        (i / 1000) % 3 == 0 ? state : state & (state >> 8) & (state >> 16)));
+  }
+  return ByteUtils::ByteVector(std::move(bytes));
+}
+
+// Checks every rank and select query against a scan of the bits.
+void ExpectMatchesScan(const ByteUtils::ByteVector& bitmap, 
+                       const ByteUtils::RankSelectIndex& index) {
+  std::size_t rank = 0;
+  for (std::size_t pos = 0; pos < bitmap.Size() * 8; pos++) {
+    ASSERT_EQ(index.Rank(pos), rank);
+    bool bit = bitmap[pos / 8][7 - pos % 8];
+    ASSERT_EQ(index.Test(pos), bit);
+    if (bit) {
+      ASSERT_EQ(index.Select(rank), pos);
+      rank++;
+    }
+  }
+  ASSERT_EQ(index.Rank(bitmap.Size() * 8), rank);
+  ASSERT_EQ(index.Ones(), rank);
+}
+
+}  // namespace
+
+TEST(TestRankSelect, TestSmall) {
+  ByteUtils::RankSelectIndex index(ByteUtils::ByteVector("8001ff"));
+  EXPECT_EQ(index.Size(), 24);
+  EXPECT_EQ(index.Rank(1), 1);
+  EXPECT_EQ(index.Rank(16), 2);
+  EXPECT_EQ(index.Select(0), 0);
+  EXPECT_EQ(index.Select(1), 15);
+  EXPECT_EQ(index.Select(9), 23);
+  EXPECT_THROW(index.Select(10), std::out_of_range);
+  EXPECT_THROW(index.Rank(25), std::out_of_range);
+  ByteUtils::RankSelectIndex empty{ByteUtils::ByteVector()};
+  EXPECT_EQ(empty.Rank(0), 0);
+  EXPECT_EQ(empty.Ones(), 0);
+}
+
+TEST(TestRankSelect, TestMatchesScan) {
+  ByteUtils::ByteVector bitmap = RandomBitmap(10003);
+  ByteUtils::RankSelectIndex index(bitmap);
+  ExpectMatchesScan(bitmap, index);
+}
+
+TEST(TestRankSelect, TestUpdate) {
+  ByteUtils::ByteVector bitmap = RandomBitmap(5000);
+  ByteUtils::RankSelectIndex index(bitmap);
+  for (std::size_t i = 1200; i < 1300; i++) {
+    bitmap[i] = ByteUtils::Byte(0xff);
+  }
+  index.Update(bitmap, 1200, 100);
+  ExpectMatchesScan(bitmap, index);
+  // Fewer set bits move the ranks of the following superblocks back.
+  for (std::size_t i = 1250; i < 1400; i++) {
+    bitmap[i] = ByteUtils::Byte(0x00);
+  }
+  index.Update(bitmap, 1250, 150);
+  ExpectMatchesScan(bitmap, index);
+  // Moving the set bits inside the modified bytes keeps the other ranks.
+  bitmap[10] = ByteUtils::Byte(0x0f);
+  bitmap[11] = ByteUtils::Byte(0xf0);
+  index.Update(bitmap, 10, 2);
+  bitmap[10] = ByteUtils::Byte(0xf0);
+  bitmap[11] = ByteUtils::Byte(0x0f);
+  index.Update(bitmap, 10, 2);
+  ExpectMatchesScan(bitmap, index);
+  bitmap[4999] = ByteUtils::Byte(0x01);
+  index.Update(bitmap, 4999, 1);
+  ExpectMatchesScan(bitmap, index);
+  EXPECT_THROW(index.Update(ByteUtils::ByteVector("00"), 0, 1), 
+               std::invalid_argument);
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/byte_vector.h"
+#include "../include/serialization.h"
+#include "../include/shared_byte_vector.h"
+#include "../include/word.h"
+
+TEST(TestSerialization, TestFormat) {
+  ByteUtils::BinaryWriter writer;
+  writer.Write(ByteUtils::ByteVector("0a1b2c"));
+  writer.Write(ByteUtils::Word("1a1b1c1d"));
+  writer.Write(std::vector<ByteUtils::ByteVector>{ByteUtils::ByteVector("ff"),
+                                                  ByteUtils::ByteVector()});
+  std::string output = writer.Build().ToHex();
+  std::string expected_output = "030a1b2c" "041a1b1c1d" "02" "01ff" "00";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestSerialization, TestRoundTrip) {
+  ByteUtils::BinaryWriter writer(ByteUtils::Checksum::kCrc32c);
+  ByteUtils::ByteVector large(std::string(600, 'e'));
+  writer.Write(large);
+  writer.Write(ByteUtils::Word("1a1b1c1d"));
+  writer.Write(std::vector<ByteUtils::Word>{ByteUtils::Word("00000001"), 
+                                            ByteUtils::Word("00000002")});
+  ByteUtils::BinaryReader reader(ByteUtils::SharedByteVector(writer.Build()),
+                                 ByteUtils::Checksum::kCrc32c);
+  ByteUtils::SharedByteVector record = reader.ReadBytes();
+  EXPECT_TRUE(record.IsShared());
+  EXPECT_STREQ(record.ToHex().c_str(), large.ToHex().c_str());
+  EXPECT_STREQ(reader.ReadWord().ToHex().c_str(), "1a1b1c1d");
+  std::vector<ByteUtils::SharedByteVector> words = reader.ReadCollection();
+  ASSERT_EQ(words.size(), 2);
+  EXPECT_STREQ(words[1].ToHex().c_str(), "00000002");
+  EXPECT_FALSE(reader.Next(record));
+}
+
+TEST(TestSerialization, TestCorruption) {
+  ByteUtils::BinaryWriter writer(ByteUtils::Checksum::kCrc32c);
+  writer.Write(ByteUtils::ByteVector("0a1b2c"));
+  ByteUtils::ByteVector bytes = writer.Build();
+  ByteUtils::ByteVector corrupted = bytes;
+  corrupted[2] = ByteUtils::Byte(0x00);
+  ByteUtils::BinaryReader reader(ByteUtils::SharedByteVector(corrupted), 
+                                 ByteUtils::Checksum::kCrc32c);
+  EXPECT_THROW(reader.ReadBytes(), std::runtime_error);
+  ByteUtils::BinaryReader truncated(ByteUtils::SharedByteVector(
+      ByteUtils::ByteVector("05aabb")));
+  EXPECT_THROW(truncated.ReadBytes(), std::runtime_error);
+}
+
+TEST(TestSerialization, TestMalformedLength) {
+  // The tenth byte of the length sets bits above the 64th, which would 
+  // wrap the length to 0.
+  ByteUtils::BinaryReader overflowing(ByteUtils::SharedByteVector(
+      ByteUtils::ByteVector("80808080808080808002")));
+  EXPECT_THROW(overflowing.ReadBytes(), std::runtime_error);
+  ByteUtils::BinaryReader unterminated(ByteUtils::SharedByteVector(
+      ByteUtils::ByteVector("ffffffffffffffffff81")));
+  EXPECT_THROW(unterminated.ReadBytes(), std::runtime_error);
+}
+
+TEST(TestSerialization, TestFileDescriptor) {
+  ByteUtils::BinaryWriter writer(ByteUtils::Checksum::kCrc32c);
+  for (int i = 0; i < 20; i++) {
+    writer.Write(ByteUtils::ByteVector(std::string(2 * i, 'a' + i % 6)));
+  }
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  writer.WriteTo(fds[1]);
+  close(fds[1]);
+  ByteUtils::BinaryReader reader(fds[0], ByteUtils::Checksum::kCrc32c, 7);
+  ByteUtils::SharedByteVector record;
+  int count = 0;
+  while (reader.Next(record)) {
+    ASSERT_EQ(record.Size(), count);
+    ASSERT_STREQ(record.ToHex().c_str(), 
+                 std::string(2 * count, 'a' + count % 6).c_str());
+    count++;
+  }
+  close(fds[0]);
+  EXPECT_EQ(count, 20);
+}
+
+TEST(TestSerialization, TestFileDescriptorViews) {
+  ByteUtils::BinaryWriter writer;
+  writer.Write(ByteUtils::ByteVector("0a"));
+  writer.Write(ByteUtils::ByteVector("1b"));
+  int fds[2];
+  ASSERT_EQ(pipe(fds), 0);
+  writer.WriteTo(fds[1]);
+  close(fds[1]);
+  // Both records are views of the same chunk.
+  ByteUtils::BinaryReader reader(fds[0], ByteUtils::Checksum::kNone, 64);
+  ByteUtils::SharedByteVector first = reader.ReadBytes();
+  ByteUtils::SharedByteVector second = reader.ReadBytes();
+  close(fds[0]);
+  EXPECT_STREQ(second.ToHex().c_str(), "1b");
+  EXPECT_EQ(second.Data(), first.Data() + 2);
+}
\ No newline at end of file
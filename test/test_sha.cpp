@@ -0,0 +1,125 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../include/byte_vector.h"
+#include "../include/cpu_features.h"
+#include "../include/sha.h"
+
+namespace {
+
+// Returns the ASCII string `text` as a `ByteVector` object.
+ByteUtils::ByteVector FromAscii(const std::string& text) {
+  std::vector<ByteUtils::Byte> bytes(text.begin(), text.end());
+  return ByteUtils::ByteVector(bytes);
+}
+
+}  // namespace
+
+TEST(TestSha, TestSha256Vectors) {
+  std::string output = ByteUtils::Sha256::Compute(FromAscii("abc")).ToHex();
+  std::string expected_output = 
+      "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  output = ByteUtils::Sha256::Compute(FromAscii("")).ToHex();
+  expected_output = 
+      "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  output = ByteUtils::Sha256::Compute(FromAscii(
+      "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq")).ToHex();
+  expected_output = 
+      "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestSha, TestPortableSha256Vectors) {
+  ByteUtils::UsePortableCodePaths(true);
+  std::string abc = ByteUtils::Sha256::Compute(FromAscii("abc")).ToHex();
+  std::string two_blocks = ByteUtils::Sha256::Compute(FromAscii(
+      "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq")).ToHex();
+  std::string million = ByteUtils::Sha256::Compute(ByteUtils::ByteVector(
+      std::vector<ByteUtils::Byte>(1000000, ByteUtils::Byte('a')))).ToHex();
+  ByteUtils::UsePortableCodePaths(false);
+  EXPECT_STREQ(abc.c_str(), 
+      "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad");
+  EXPECT_STREQ(two_blocks.c_str(), 
+      "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1");
+  EXPECT_STREQ(million.c_str(), 
+      "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0");
+}
+
+TEST(TestSha, TestSha512Vectors) {
+  std::string output = ByteUtils::Sha512::Compute(FromAscii("abc")).ToHex();
+  std::string expected_output = 
+      "ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+      "2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  output = ByteUtils::Sha512::Compute(FromAscii(
+      "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+      "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu")).ToHex();
+  expected_output = 
+      "8e959b75dae313da8cf4f72814fc143f8f7779c6eb9f7fa17299aeadb6889018"
+      "501d289e4900f7e4331b99dec4b5433ac7d329eeb6dd26545e96e55b874be909";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestSha, TestIncrementalUpdate) {
+  // One million repetitions of "a", fed in uneven pieces.
+  std::string million(1000000, 'a');
+  ByteUtils::Sha256 sha256;
+  ByteUtils::Sha512 sha512;
+  std::size_t pos = 0;
+  for (std::size_t size = 1; pos < million.size(); size = size * 3 % 1000 + 1) {
+    size = std::min(size, million.size() - pos);
+    auto data = reinterpret_cast<const std::uint8_t*>(million.data() + pos);
+    sha256.Update(data, size);
+    sha512.Update(data, size);
+    pos += size;
+  }
+  std::string output = sha256.Finalize().ToHex();
+  std::string expected_output = 
+      "cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  output = sha512.Finalize().ToHex();
+  expected_output = 
+      "e718483d0ce769644e2e42c7bc15b4638e1f98b13b2044285632a803afa973eb"
+      "de0ff244877ea60a4cb0432ce577c31beb009c5c2c49aa2e4eadb217ad8cc09b";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestSha, TestStreamUpdate) {
+  std::istringstream stream("abc");
+  ByteUtils::Sha256 sha;
+  sha.Update(stream);
+  std::string output = sha.Finalize().ToHex();
+  std::string expected_output = 
+      "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  // The computation restarts after `Finalize`.
+  output = sha.Finalize().ToHex();
+  expected_output = 
+      "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
\ No newline at end of file
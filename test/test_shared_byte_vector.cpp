@@ -0,0 +1,113 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <array>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/byte_vector.h"
+#include "../include/shared_byte_vector.h"
+
+TEST(TestSharedByteVector, TestConstructor) {
+  ByteUtils::SharedByteVector bytes(ByteUtils::ByteVector("0a1b2c3d"));
+  EXPECT_EQ(bytes.Size(), 4);
+  EXPECT_STREQ(bytes.ToHex().c_str(), "0a1b2c3d");
+  EXPECT_FALSE(bytes.IsShared());
+}
+
+TEST(TestSharedByteVector, TestSlice) {
+  ByteUtils::SharedByteVector bytes(ByteUtils::ByteVector("0a1b2c3d4e"));
+  ByteUtils::SharedByteVector slice = bytes.Slice(1, 3);
+  EXPECT_TRUE(bytes.IsShared());
+  EXPECT_STREQ(slice.ToHex().c_str(), "1b2c3d");
+  ByteUtils::SharedByteVector nested = slice.Slice(1, 2);
+  EXPECT_STREQ(nested.ToHex().c_str(), "2c3d");
+  EXPECT_STREQ(nested[1].ToHex().c_str(), "3d");
+  EXPECT_STREQ(nested.ToByteVector().ToHex().c_str(), "2c3d");
+  EXPECT_THROW(slice.Slice(2, 2), std::out_of_range);
+  EXPECT_THROW(nested[2], std::out_of_range);
+  EXPECT_THROW(nested.Set(2, ByteUtils::Byte(0)), std::out_of_range);
+}
+
+TEST(TestSharedByteVector, TestReadDoesNotCopy) {
+  ByteUtils::SharedByteVector bytes(ByteUtils::ByteVector("0a1b2c3d"));
+  ByteUtils::SharedByteVector slice = bytes.Slice(1, 2);
+  const ByteUtils::Byte* data = slice.Data();
+  EXPECT_STREQ(slice[0].ToHex().c_str(), "1b");
+  EXPECT_EQ(slice.Data(), data);
+  EXPECT_TRUE(slice.IsShared());
+}
+
+TEST(TestSharedByteVector, TestCopyOnWrite) {
+  ByteUtils::SharedByteVector bytes(ByteUtils::ByteVector("0a1b2c3d"));
+  ByteUtils::SharedByteVector slice = bytes.Slice(2, 2);
+  slice.Set(0, ByteUtils::Byte(0xff));
+  EXPECT_STREQ(slice.ToHex().c_str(), "ff3d");
+  EXPECT_STREQ(bytes.ToHex().c_str(), "0a1b2c3d");
+  EXPECT_FALSE(slice.IsShared());
+  EXPECT_FALSE(bytes.IsShared());
+  // A view that isn't shared is modified in place.
+  bytes.Set(0, ByteUtils::Byte(0x00));
+  EXPECT_STREQ(bytes.ToHex().c_str(), "001b2c3d");
+}
+
+TEST(TestSharedByteVector, TestConcurrentReaders) {
+  std::string hex;
+  for (int index = 0; index < 1024; index++) {
+    hex += "a5";
+  }
+  const ByteUtils::SharedByteVector bytes{ByteUtils::ByteVector(hex)};
+  const ByteUtils::Byte* data = bytes.Data();
+  std::vector<std::thread> threads;
+  std::vector<std::size_t> counts(4, 0);
+  for (std::size_t thread = 0; thread < counts.size(); thread++) {
+    threads.emplace_back([&bytes, &counts, thread]() {
+      for (std::size_t index = 0; index < 1000; index++) {
+        const ByteUtils::SharedByteVector& shared = bytes;
+        const ByteUtils::SharedByteVector slice = shared.Slice(index, 24);
+        counts[thread] += shared[index].ToInt() == 0xa5;
+        counts[thread] += slice[23].ToInt() == 0xa5;
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  for (const auto& count : counts) {
+    EXPECT_EQ(count, 2000);
+  }
+  // The readers never copied the shared buffer.
+  EXPECT_EQ(bytes.Data(), data);
+  EXPECT_FALSE(bytes.IsShared());
+}
+
+TEST(TestSharedByteVector, TestSubstitute) {
+  std::array<ByteUtils::Byte, 256> table;
+  for (int value = 0; value < 256; value++) {
+    table[value] = ByteUtils::Byte(value ^ 0xff);
+  }
+  ByteUtils::SharedByteVector bytes(ByteUtils::ByteVector("0a1b2c3d"));
+  ByteUtils::SharedByteVector slice = bytes.Slice(1, 2);
+  slice.Substitute(table);
+  EXPECT_STREQ(slice.ToHex().c_str(), "e4d3");
+  EXPECT_STREQ(bytes.ToHex().c_str(), "0a1b2c3d");
+}
\ No newline at end of file
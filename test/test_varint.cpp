@@ -0,0 +1,101 @@
+/* 
+  Copyright (C) 2023  Oprișor Adrian-Ilie
+  
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+  
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+  
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+   
+  Contact: contact@dev-adrian.com
+*/
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/byte_vector.h"
+#include "../include/cpu_features.h"
+#include "../include/varint.h"
+
+TEST(TestVarint, TestEncode) {
+  std::vector<std::uint32_t> values = {0, 1, 127, 128, 300, 0xffffffff};
+  std::string output = ByteUtils::EncodeVarints(values).ToHex();
+  std::string expected_output = "00017f8001ac02ffffffff0f";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  std::vector<std::uint64_t> wide = {std::numeric_limits<std::uint64_t>::max()};
+  output = ByteUtils::EncodeVarints(wide).ToHex();
+  expected_output = "ffffffffffffffffff01";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestVarint, TestRoundTrip) {
+  std::vector<std::uint64_t> values;
+  std::uint64_t state = 0x9e3779b97f4a7c15;
+  for (int i = 0; i < 1000; i++) {
+    state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+    // Mixes every encoded length, including runs of 1-byte values.
+    values.push_back(i % 3 == 0 ? state % 100 : state >> (state % 64));
+  }
+  std::vector<std::uint64_t> decoded;
+  ByteUtils::DecodeVarints(ByteUtils::EncodeVarints(values), decoded);
+  EXPECT_EQ(decoded, values);
+  std::vector<std::uint32_t> narrow(values.begin(), values.end());
+  std::vector<std::uint32_t> narrow_decoded;
+  ByteUtils::DecodeVarints(ByteUtils::EncodeVarints(narrow), narrow_decoded);
+  EXPECT_EQ(narrow_decoded, narrow);
+}
+
+TEST(TestVarint, TestMalformed) {
+  std::vector<std::uint32_t> values;
+  EXPECT_THROW(ByteUtils::DecodeVarints(ByteUtils::ByteVector("0180"), values),
+               std::runtime_error);
+  EXPECT_THROW(ByteUtils::DecodeVarints(
+                   ByteUtils::ByteVector("ffffffff1f000000"), values),
+               std::runtime_error);
+  std::vector<std::uint64_t> wide;
+  EXPECT_THROW(ByteUtils::DecodeVarints(
+                   ByteUtils::ByteVector("ffffffffffffffffff02"), wide),
+               std::runtime_error);
+}
+
+TEST(TestVarint, TestPortableDecoder) {
+  std::vector<std::uint64_t> values;
+  std::uint64_t state = 0x2545f4914f6cdd1d;
+  for (int i = 0; i < 4000; i++) {
+    state ^= state << 13; state ^= state >> 7; state ^= state << 17;
+    // Mostly varints of 1 to 4 bytes, with longer ones in between.
+    int bits = i % 50 == 0 ? 64 : 7 * (state % 4 + 1);
+    values.push_back(state >> (64 - bits));
+  }
+  ByteUtils::ByteVector bytes = ByteUtils::EncodeVarints(values);
+  std::vector<std::uint64_t> decoded;
+  std::vector<std::uint32_t> narrow_decoded;
+  ByteUtils::DecodeVarints(bytes, decoded);
+  ByteUtils::UsePortableCodePaths(true);
+  std::vector<std::uint64_t> portable_decoded;
+  ByteUtils::DecodeVarints(bytes, portable_decoded);
+  EXPECT_THROW(ByteUtils::DecodeVarints(bytes, narrow_decoded), 
+               std::runtime_error);
+  ByteUtils::UsePortableCodePaths(false);
+  EXPECT_EQ(decoded, values);
+  EXPECT_EQ(portable_decoded, values);
+  narrow_decoded.clear();
+  EXPECT_THROW(ByteUtils::DecodeVarints(bytes, narrow_decoded), 
+               std::runtime_error);
+  std::vector<std::uint32_t> narrow(values.begin(), values.end());
+  bytes = ByteUtils::EncodeVarints(narrow);
+  narrow_decoded.clear();
+  ByteUtils::DecodeVarints(bytes, narrow_decoded);
+  EXPECT_EQ(narrow_decoded, narrow);
+}
\ No newline at end of file
@@ -18,12 +18,42 @@
 */
 #include <gtest/gtest.h>
 
+#include <array>
 #include <iostream>
 #include <string>
 #include <vector>
 
 #include "../include/byte.h"
 #include "../include/word.h"
+#include "allocation_counter.h"
+
+namespace {
+
+// Builds the AES S-box from the multiplicative inverse in GF(2^8) 
+// followed by the affine transformation.
+std::array<ByteUtils::Byte, 256> MakeAesSBox() {
+  std::array<ByteUtils::Byte, 256> sbox;
+  for (int value = 0; value < 256; value++) {
+    ByteUtils::Byte inverse(0x00);
+    for (int candidate = 1; candidate < 256 && value != 0; candidate++) {
+      ByteUtils::Byte product = ByteUtils::Byte(value) * 
+                                ByteUtils::Byte(candidate);
+      if (product.ToInt() == 1) {
+        inverse = ByteUtils::Byte(candidate);
+        break;
+      }
+    }
+    int x = inverse.ToInt();
+    int result = x;
+    for (int shift = 1; shift < 5; shift++) {
+      result ^= ((x << shift) | (x >> (8 - shift))) & 0xff;
+    }
+    sbox[value] = ByteUtils::Byte(result ^ 0x63);
+  }
+  return sbox;
+}
+
+}  // namespace
 
 TEST(TestWord, TestHexStringConstructor) {
   ByteUtils::Word word("1a1b1cf");
@@ -208,4 +238,86 @@ TEST(TestWord, TestPushBack) {
   std::string output = word.ToHex();
   std::string expected_output = "ff";
   EXPECT_STREQ(output.c_str(), expected_output.c_str()); 
+}
+
+TEST(TestWord, TestCompoundAssignmentOperators) {
+  ByteUtils::Word word("f0f0f0f0");
+  word ^= ByteUtils::Word("ffffffff");
+  ASSERT_STREQ(word.ToHex().c_str(), "0f0f0f0f");
+  word |= ByteUtils::Word("f0000000");
+  ASSERT_STREQ(word.ToHex().c_str(), "ff0f0f0f");
+  word &= ByteUtils::Word("ffff0000");
+  ASSERT_STREQ(word.ToHex().c_str(), "ff0f0000");
+  word ^= ByteUtils::Byte(0x01);
+  EXPECT_STREQ(word.ToHex().c_str(), "fe0e0101");
+  EXPECT_THROW(word &= ByteUtils::Word("ff", 64), std::runtime_error);
+}
+
+TEST(TestWord, TestShiftAssignmentOperators) {
+  ByteUtils::Word word("8000000f");
+  word <<= 12;
+  ASSERT_STREQ(word.ToHex().c_str(), "0000f000");
+  word >>= 9;
+  EXPECT_STREQ(word.ToHex().c_str(), "00000078");
+  EXPECT_THROW(word <<= 33, std::out_of_range);
+}
+
+TEST(TestWord, TestRvalueChainAllocatesOnce) {
+  ByteUtils::Word a("0f0f0f0f");
+  ByteUtils::Word b("ff00ff00");
+  ByteUtils::Word c("ffff0000");
+  AllocationCounter::Reset();
+  ByteUtils::Word result = ~((a ^ b) & c) >> 4;
+  std::size_t allocations = AllocationCounter::Count();
+  EXPECT_LE(allocations, 1);
+  EXPECT_STREQ(result.ToHex().c_str(), "00ff0fff");
+}
+
+TEST(TestWord, TestSubstitute) {
+  // SubWord step from the AES-128 key expansion (FIPS 197, appendix A.1).
+  ByteUtils::Word word("cf4f3c09");
+  word.Substitute(MakeAesSBox());
+  std::string output = word.ToHex();
+  std::string expected_output = "8a84eb01";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestWord, TestModularAddition) {
+  ByteUtils::Word word1("ffffffff");
+  ByteUtils::Word word2("00000002");
+  EXPECT_STREQ((word1 + word2).ToHex().c_str(), "00000001");
+  EXPECT_STREQ((word2 - word1).ToHex().c_str(), "00000003");
+  ByteUtils::Word word3("6a09e667");
+  word3 += ByteUtils::Word("bb67ae85");
+  EXPECT_STREQ(word3.ToHex().c_str(), "257194ec");
+  word3 -= ByteUtils::Word("bb67ae85");
+  EXPECT_STREQ(word3.ToHex().c_str(), "6a09e667");
+  EXPECT_THROW(word1 + ByteUtils::Word("ff", 64), std::runtime_error);
+}
+
+TEST(TestWord, TestRotation) {
+  ByteUtils::Word word("80000001");
+  EXPECT_STREQ(word.RotateLeft(1).ToHex().c_str(), "00000003");
+  EXPECT_STREQ(word.RotateRight(1).ToHex().c_str(), "c0000000");
+  EXPECT_STREQ(word.RotateLeft(36).ToHex().c_str(), "00000018");
+  EXPECT_STREQ(word.RotateRight(32).ToHex().c_str(), "80000001");
+}
+
+TEST(TestWord, TestReverse) {
+  ByteUtils::Word word("01020380");
+  std::string output = ByteUtils::ReverseBytes(word).ToHex();
+  std::string expected_output = "80030201";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+  word.ReverseBits();
+  output = word.ToHex();
+  expected_output = "8040c001";
+  EXPECT_STREQ(output.c_str(), expected_output.c_str());
+}
+
+TEST(TestWord, TestAccessWideWord) {
+  ByteUtils::Word word("0102030405060708", 64);
+  EXPECT_STREQ(word[5].ToHex().c_str(), "06");
+  word.Data()[7] = ByteUtils::Byte(0xff);
+  EXPECT_STREQ(word.ToHex().c_str(), "01020304050607ff");
+  EXPECT_THROW(word[8], std::out_of_range);
 }
\ No newline at end of file